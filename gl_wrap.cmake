@@ -40,6 +40,8 @@ function(load_gl_wrap
         ${__GLWRAP_DIR}/include/gl_wrap/gl_error_checking.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/gl_extensions.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/gl_context.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/gl_dsa.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/gl_draw.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/gl_glsl_version.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/gl_glsl_version_str.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/gl_scissor.hpp
@@ -49,18 +51,42 @@ function(load_gl_wrap
 
         ${__GLWRAP_DIR}/include/gl_wrap/utils/gl_ColorRGBA.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/utils/gl_Rect.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/utils/std140.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/utils/std430.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/utils/mesh_optimizer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/utils/vertex_packing.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/utils/macros.hpp
 
 
         ${__GLWRAP_DIR}/include/gl_wrap/objects/Object.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/ProgramBinaryCache.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/ProgramReflection.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/NamePool.hpp
 
         ${__GLWRAP_DIR}/include/gl_wrap/objects/Shader.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/objects/ShaderProgram.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/UniformLocationCache.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/UniformId.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/UniformValueCache.hpp
 
         ${__GLWRAP_DIR}/include/gl_wrap/objects/Texture.hpp
 
         ${__GLWRAP_DIR}/include/gl_wrap/objects/Buffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/BufferMapping.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/BufferReadback.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/Fence.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/StreamingRingBuffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/OrphaningBuffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/BufferArena.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/BufferPool.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/ShadowedBuffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/GpuVector.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/UniformBuffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/ShaderStorageBuffer.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/DrawIndirectBuffer.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/objects/VertexArrayObject.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/VertexLayout.hpp
+        ${__GLWRAP_DIR}/include/gl_wrap/objects/InstanceStream.hpp
 
         ${__GLWRAP_DIR}/include/gl_wrap/objects/RenderBuffer.hpp
         ${__GLWRAP_DIR}/include/gl_wrap/objects/FrameBuffer.hpp
@@ -70,6 +96,8 @@ function(load_gl_wrap
         ${__GLWRAP_DIR}/sources/gl_error_checking.cpp
         ${__GLWRAP_DIR}/sources/gl_extensions.cpp
         ${__GLWRAP_DIR}/sources/gl_context.cpp
+        ${__GLWRAP_DIR}/sources/gl_dsa.cpp
+        ${__GLWRAP_DIR}/sources/gl_draw.cpp
         ${__GLWRAP_DIR}/sources/gl_glsl_version.cpp
         ${__GLWRAP_DIR}/sources/gl_glsl_version_str.cpp
         ${__GLWRAP_DIR}/sources/gl_scissor.cpp
@@ -79,17 +107,40 @@ function(load_gl_wrap
 
         ${__GLWRAP_DIR}/sources/utils/gl_ColorRGBA.cpp
         ${__GLWRAP_DIR}/sources/utils/gl_Rect.cpp
+        ${__GLWRAP_DIR}/sources/utils/std140.cpp
+        ${__GLWRAP_DIR}/sources/utils/std430.cpp
+        ${__GLWRAP_DIR}/sources/utils/mesh_optimizer.cpp
+        ${__GLWRAP_DIR}/sources/utils/vertex_packing.cpp
 
 
         ${__GLWRAP_DIR}/sources/objects/Object.cpp
+        ${__GLWRAP_DIR}/sources/objects/ProgramBinaryCache.cpp
+        ${__GLWRAP_DIR}/sources/objects/ProgramReflection.cpp
+        ${__GLWRAP_DIR}/sources/objects/NamePool.cpp
 
         ${__GLWRAP_DIR}/sources/objects/Shader.cpp
         ${__GLWRAP_DIR}/sources/objects/ShaderProgram.cpp
+        ${__GLWRAP_DIR}/sources/objects/UniformLocationCache.cpp
+        ${__GLWRAP_DIR}/sources/objects/UniformValueCache.cpp
 
         ${__GLWRAP_DIR}/sources/objects/Texture.cpp
 
         ${__GLWRAP_DIR}/sources/objects/Buffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/BufferMapping.cpp
+        ${__GLWRAP_DIR}/sources/objects/BufferReadback.cpp
+        ${__GLWRAP_DIR}/sources/objects/Fence.cpp
+        ${__GLWRAP_DIR}/sources/objects/StreamingRingBuffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/OrphaningBuffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/BufferArena.cpp
+        ${__GLWRAP_DIR}/sources/objects/BufferPool.cpp
+        ${__GLWRAP_DIR}/sources/objects/ShadowedBuffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/GpuVector.cpp
+        ${__GLWRAP_DIR}/sources/objects/UniformBuffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/ShaderStorageBuffer.cpp
+        ${__GLWRAP_DIR}/sources/objects/DrawIndirectBuffer.cpp
         ${__GLWRAP_DIR}/sources/objects/VertexArrayObject.cpp
+        ${__GLWRAP_DIR}/sources/objects/VertexLayout.cpp
+        ${__GLWRAP_DIR}/sources/objects/InstanceStream.cpp
 
         ${__GLWRAP_DIR}/sources/objects/RenderBuffer.cpp
         ${__GLWRAP_DIR}/sources/objects/FrameBuffer.cpp
@@ -4,6 +4,8 @@ HEADERS += \
     $$PWD/include/gl_wrap/gl_error_checking.hpp \
     $$PWD/include/gl_wrap/gl_extensions.hpp \
     $$PWD/include/gl_wrap/gl_context.hpp \
+    $$PWD/include/gl_wrap/gl_dsa.hpp \
+    $$PWD/include/gl_wrap/gl_draw.hpp \
     $$PWD/include/gl_wrap/gl_glsl_version.hpp \
     $$PWD/include/gl_wrap/gl_glsl_version_str.hpp \
     $$PWD/include/gl_wrap/gl_scissor.hpp \
@@ -13,18 +15,42 @@ HEADERS += \
     \
     $$PWD/include/gl_wrap/utils/gl_ColorRGBA.hpp \
     $$PWD/include/gl_wrap/utils/gl_Rect.hpp \
+    $$PWD/include/gl_wrap/utils/std140.hpp \
+    $$PWD/include/gl_wrap/utils/std430.hpp \
+    $$PWD/include/gl_wrap/utils/mesh_optimizer.hpp \
+    $$PWD/include/gl_wrap/utils/vertex_packing.hpp \
     $$PWD/include/gl_wrap/utils/macros.hpp \
     \
     \
     $$PWD/include/gl_wrap/objects/Object.hpp \
+    $$PWD/include/gl_wrap/objects/ProgramBinaryCache.hpp \
+    $$PWD/include/gl_wrap/objects/ProgramReflection.hpp \
+    $$PWD/include/gl_wrap/objects/NamePool.hpp \
     \
     $$PWD/include/gl_wrap/objects/Shader.hpp \
     $$PWD/include/gl_wrap/objects/ShaderProgram.hpp \
+    $$PWD/include/gl_wrap/objects/UniformLocationCache.hpp \
+    $$PWD/include/gl_wrap/objects/UniformId.hpp \
+    $$PWD/include/gl_wrap/objects/UniformValueCache.hpp \
     \
     $$PWD/include/gl_wrap/objects/Texture.hpp \
     \
     $$PWD/include/gl_wrap/objects/Buffer.hpp \
+    $$PWD/include/gl_wrap/objects/BufferMapping.hpp \
+    $$PWD/include/gl_wrap/objects/BufferReadback.hpp \
+    $$PWD/include/gl_wrap/objects/Fence.hpp \
+    $$PWD/include/gl_wrap/objects/StreamingRingBuffer.hpp \
+    $$PWD/include/gl_wrap/objects/OrphaningBuffer.hpp \
+    $$PWD/include/gl_wrap/objects/BufferArena.hpp \
+    $$PWD/include/gl_wrap/objects/BufferPool.hpp \
+    $$PWD/include/gl_wrap/objects/ShadowedBuffer.hpp \
+    $$PWD/include/gl_wrap/objects/GpuVector.hpp \
+    $$PWD/include/gl_wrap/objects/UniformBuffer.hpp \
+    $$PWD/include/gl_wrap/objects/ShaderStorageBuffer.hpp \
+    $$PWD/include/gl_wrap/objects/DrawIndirectBuffer.hpp \
     $$PWD/include/gl_wrap/objects/VertexArrayObject.hpp \
+    $$PWD/include/gl_wrap/objects/VertexLayout.hpp \
+    $$PWD/include/gl_wrap/objects/InstanceStream.hpp \
     \
     $$PWD/include/gl_wrap/objects/RenderBuffer.hpp \
     $$PWD/include/gl_wrap/objects/FrameBuffer.hpp
@@ -33,6 +59,8 @@ SOURCES += \
     $$PWD/sources/gl_error_checking.cpp \
     $$PWD/sources/gl_extensions.cpp \
     $$PWD/sources/gl_context.cpp \
+    $$PWD/sources/gl_dsa.cpp \
+    $$PWD/sources/gl_draw.cpp \
     $$PWD/sources/gl_glsl_version.cpp \
     $$PWD/sources/gl_glsl_version_str.cpp \
     $$PWD/sources/gl_scissor.cpp \
@@ -42,17 +70,40 @@ SOURCES += \
     \
     $$PWD/sources/utils/gl_ColorRGBA.cpp \
     $$PWD/sources/utils/gl_Rect.cpp \
+    $$PWD/sources/utils/std140.cpp \
+    $$PWD/sources/utils/std430.cpp \
+    $$PWD/sources/utils/mesh_optimizer.cpp \
+    $$PWD/sources/utils/vertex_packing.cpp \
     \
     \
     $$PWD/sources/objects/Object.cpp \
+    $$PWD/sources/objects/ProgramBinaryCache.cpp \
+    $$PWD/sources/objects/ProgramReflection.cpp \
+    $$PWD/sources/objects/NamePool.cpp \
     \
     $$PWD/sources/objects/Shader.cpp \
     $$PWD/sources/objects/ShaderProgram.cpp \
+    $$PWD/sources/objects/UniformLocationCache.cpp \
+    $$PWD/sources/objects/UniformValueCache.cpp \
     \
     $$PWD/sources/objects/Texture.cpp \
     \
     $$PWD/sources/objects/Buffer.cpp \
+    $$PWD/sources/objects/BufferMapping.cpp \
+    $$PWD/sources/objects/BufferReadback.cpp \
+    $$PWD/sources/objects/Fence.cpp \
+    $$PWD/sources/objects/StreamingRingBuffer.cpp \
+    $$PWD/sources/objects/OrphaningBuffer.cpp \
+    $$PWD/sources/objects/BufferArena.cpp \
+    $$PWD/sources/objects/BufferPool.cpp \
+    $$PWD/sources/objects/ShadowedBuffer.cpp \
+    $$PWD/sources/objects/GpuVector.cpp \
+    $$PWD/sources/objects/UniformBuffer.cpp \
+    $$PWD/sources/objects/ShaderStorageBuffer.cpp \
+    $$PWD/sources/objects/DrawIndirectBuffer.cpp \
     $$PWD/sources/objects/VertexArrayObject.cpp \
+    $$PWD/sources/objects/VertexLayout.cpp \
+    $$PWD/sources/objects/InstanceStream.cpp \
     \
     $$PWD/sources/objects/RenderBuffer.cpp \
     $$PWD/sources/objects/FrameBuffer.cpp
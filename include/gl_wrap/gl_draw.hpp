@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+
+namespace gl {
+
+/**
+    @brief Draw calls. Indexed draws take 'offset' in bytes, inside of
+      GL_ELEMENT_ARRAY_BUFFER, binded to current VAO.
+*/
+struct Draw
+{
+    static void arrays(int mode, int first, int count);
+    static void elements(int mode, int count, int type, size_t offset = 0);
+
+    // -------------------------------------------------------------------------
+    // Instanced
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    static void arraysInstanced(int mode, int first, int count, int instance_count);
+    static void elementsInstanced(int mode, int count, int type, size_t offset, int instance_count);
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 2) // Base instance not present in OpenGL ES
+    /// Per-instance attributes are fetched starting from 'base_instance'
+    static void arraysInstancedBaseInstance(int mode, int first, int count, int instance_count, unsigned int base_instance);
+    static void elementsInstancedBaseInstance(int mode, int count, int type, size_t offset, int instance_count, unsigned int base_instance);
+#endif
+};
+
+} // namespace gl
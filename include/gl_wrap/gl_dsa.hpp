@@ -0,0 +1,57 @@
+#pragma once
+
+#include <gl_wrap/gl_version.hpp>
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Direct State Access (DSA) code path selection.
+
+    DSA functions (glNamedBufferSubData(), glTextureSubImage2D(), etc) allow to
+    edit object without binding it, so editing not disturbs current bindings
+    and no bind/unbind pair (and GLWRAP_CHECK_BINDED queries) needed.
+
+    - `GLWRAP_GL_DSA_AVAILABLE` - defined, when DSA code path compiled in:
+        - Desktop OpenGL only (not present in OpenGL ES)
+        - May be disabled by defining `GLWRAP_DISABLE_DSA`
+
+    - `GLWRAP_GL_DSA_ENABLED()` - whether DSA path must be used now:
+        - OpenGL >= 4.5 - always (compile-time `true`)
+        - OpenGL <  4.5 - if 'GL_ARB_direct_state_access' extension supported
+          (checked in run-time, once)
+
+    @code{.cpp}
+    #if defined(GLWRAP_GL_DSA_AVAILABLE)
+        if(GLWRAP_GL_DSA_ENABLED())
+        {
+            glNamedBufferSubData(_id, offset, size, data);
+            return;
+        }
+    #endif
+
+        glBufferSubData(_target, offset, size, data); // Buffer must be binded
+    @endcode
+*/
+
+#if defined(GLWRAP_GL_OPENGL) && !defined(GLWRAP_DISABLE_DSA)
+
+    #define GLWRAP_GL_DSA_AVAILABLE
+
+    #if GLWRAP_GL_FROM_OPENGL_VER(4, 5)
+        #define GLWRAP_GL_DSA_ENABLED() \
+            (true)
+    #else
+        #define GLWRAP_GL_DSA_ENABLED() \
+            (gl::isDirectStateAccessSupported())
+    #endif
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+namespace gl {
+
+/// Result is cached after first call (requires current context)
+bool isDirectStateAccessSupported();
+
+} // namespace gl
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <gl_wrap/objects/Object.hpp>
+#include <gl_wrap/objects/BufferMapping.hpp>
+#include <gl_wrap/objects/BufferReadback.hpp>
+
+#include <gl_wrap/gl_version.hpp>
 
 #include <cstddef> // for size_t
 
@@ -17,8 +21,10 @@ public:
 
     // -------------------------------------------------------------------------
 
-    // Moveable
-    GLWRAP_MOVE_DEFAULT(Buffer);
+    // Moveable (moved-from buffer is left without name, assigned-to one
+    // deletes its own buffer first)
+    Buffer(Buffer&& other);
+    Buffer& operator = (Buffer&& other);
 
     // Non-copyable
     GLWRAP_PREVENT_COPY_AND_ASSIGN(Buffer);
@@ -28,6 +34,16 @@ public:
     void bind();
     void unbind();
 
+    int getTarget() const;
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// Indexed binding (for GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER,
+    /// GL_TRANSFORM_FEEDBACK_BUFFER, GL_ATOMIC_COUNTER_BUFFER targets).
+    /// NOTE: generic binding point of target is changed too.
+    void bindBase(unsigned int index);
+    void bindRange(unsigned int index, long offset, size_t size);
+#endif
+
     // -------------------------------------------------------------------------
 
     void setDataRaw(size_t size, const void *data, int usage);
@@ -56,8 +72,61 @@ public:
     }
 
     // -------------------------------------------------------------------------
+    // Immutable storage
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 4) // glBufferStorage() not present in OpenGL ES (only as extension)
+    /// 'flags' is combination of: GL_DYNAMIC_STORAGE_BIT, GL_MAP_READ_BIT,
+    /// GL_MAP_WRITE_BIT, GL_MAP_PERSISTENT_BIT, GL_MAP_COHERENT_BIT,
+    /// GL_CLIENT_STORAGE_BIT
+    void setStorageRaw(size_t size, const void* data, int flags);
+#endif
+
+    // -------------------------------------------------------------------------
+    // Mapping (low-level)
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// Returns nullptr in case of error
+    void* mapRangeRaw(long offset, size_t length, int access);
+
+    /// Returns false, if buffer contents became corrupt while it was mapped
+    bool unmap();
+
+    /// 'offset' is relative to the beginning of mapped range
+    void flushMappedRangeRaw(long offset, size_t length);
+#endif
 
-    // TODO: mapping: glMapBuffer(), glUnmapBuffer(), glGetBufferPointerv(), glGet( GL_MIN_MAP_BUFFER_ALIGNMENT ), *glMapBufferRange()*??, *glGetBufferSubData()*??
+    // -------------------------------------------------------------------------
+    // Mapping (scoped)
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// 'access' is combination of: GL_MAP_READ_BIT, GL_MAP_WRITE_BIT,
+    /// GL_MAP_INVALIDATE_RANGE_BIT, GL_MAP_INVALIDATE_BUFFER_BIT,
+    /// GL_MAP_FLUSH_EXPLICIT_BIT, GL_MAP_UNSYNCHRONIZED_BIT
+    BufferMapping map(long offset, size_t length, int access);
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 2) // GL_MIN_MAP_BUFFER_ALIGNMENT not present in OpenGL ES
+    static int getMinMapBufferAlignment();
+#endif
+
+    // TODO: glGetBufferPointerv(), glGetBufferSubData()
+
+    // -------------------------------------------------------------------------
+    // Copying & asynchronous reading
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// GPU-side copy (glCopyBufferSubData()). Without DSA, buffers binded to
+    /// GL_COPY_READ_BUFFER & GL_COPY_WRITE_BUFFER targets.
+    static void copySubData(Buffer& source, long source_offset,
+                            Buffer& destination, long destination_offset,
+                            size_t size);
+#endif
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// Starts asynchronous read of range, without stalling pipeline. Binding
+    /// of GL_COPY_WRITE_BUFFER target is changed.
+    BufferReadback readAsync(long offset, size_t size);
+#endif
 
     // -------------------------------------------------------------------------
     // Parameters access
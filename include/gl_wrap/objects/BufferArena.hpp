@@ -0,0 +1,122 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <cstddef> // for size_t
+#include <map>
+#include <memory>  // for std::unique_ptr<T>
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Sub-allocator, that places many small allocations (meshes, uniform
+           blocks, etc) into few large buffers ('blocks').
+
+    Free space tracked per-block as offset-ordered ranges (so freed neighbours
+    coalesced), plus size-ordered index for best-fit search. Allocation too big
+    for regular block gets its own dedicated block.
+
+    For GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER targets, offsets
+    additionally aligned to GL_{UNIFORM|SHADER_STORAGE}_BUFFER_OFFSET_ALIGNMENT,
+    so allocations can be passed to glBindBufferRange() directly.
+
+    @code{.cpp}
+    gl::BufferArena arena(GL_ARRAY_BUFFER, GL_STATIC_DRAW, 16 * 1024 * 1024);
+
+    const auto alloc = arena.allocate(sizeof(vertices), sizeof(Vertex));
+    if(alloc.isOk())
+    {
+        alloc.buffer->bind();
+        alloc.buffer->setSubDataRaw(alloc.offset, sizeof(vertices), vertices);
+
+        // Base vertex for glDrawElementsBaseVertex()
+        const int base_vertex = static_cast<int>(alloc.offset / sizeof(Vertex));
+    }
+
+    // ...
+    arena.free(alloc);
+    @endcode
+*/
+class BufferArena
+{
+public:
+
+    struct Allocation
+    {
+        Buffer* buffer; // Owned by arena
+        size_t  block;  // Index of block, that holds allocation
+        size_t  offset; // Offset from the beginning of buffer
+        size_t  size;
+
+        inline bool isOk() const { return (buffer != nullptr); }
+    };
+
+private:
+
+    int _target;
+    int _usage;
+
+    size_t _block_size;
+    size_t _min_alignment;
+
+    std::vector< std::unique_ptr<Buffer> > _blocks;
+
+    // Per-block free ranges: offset -> size
+    std::vector< std::map<size_t, size_t> > _free_by_offset;
+
+    // All free ranges: size -> (block, offset)
+    std::multimap<size_t, std::pair<size_t, size_t> > _free_by_size;
+
+    size_t _allocated_size;
+
+public:
+
+    BufferArena(int target, int usage, size_t block_size);
+    virtual ~BufferArena();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(BufferArena);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(BufferArena);
+
+    // -------------------------------------------------------------------------
+
+    /// 'alignment' must be power of two. Returns not-ok allocation in case of
+    /// error.
+    Allocation allocate(size_t size, size_t alignment = 1);
+
+    void free(const Allocation& allocation);
+
+    // -------------------------------------------------------------------------
+
+    int getTarget() const;
+    int getUsage() const;
+
+    size_t getBlockSize() const;
+    size_t getBlocksCount() const;
+    Buffer* getBlock(size_t index) const;
+
+    /// Minimal alignment, applied to every allocation (depends on target)
+    size_t getMinAlignment() const;
+
+    size_t getAllocatedSize() const;
+    size_t getFreeSize() const;
+
+    // -------------------------------------------------------------------------
+
+    /// Offset alignment, required by target for glBindBufferRange() (or 1)
+    static size_t getTargetOffsetAlignment(int target);
+
+private:
+
+    size_t addBlock(size_t size);
+
+    void insertFreeRange(size_t block, size_t offset, size_t size);
+    void eraseFreeRange(size_t block, size_t offset, size_t size);
+};
+
+} // namespace gl
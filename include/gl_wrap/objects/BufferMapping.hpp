@@ -0,0 +1,122 @@
+#pragma once
+
+#include <gl_wrap/utils/macros.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <vector>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+class Buffer;
+
+/**
+    @brief Scoped mapping of buffer range (glMapBufferRange()), returned by
+           gl::Buffer::map(). Range unmapped on destruction.
+
+    In case of GL_MAP_FLUSH_EXPLICIT_BIT, modified sub-ranges must be reported
+    via markDirty() (or written via write()) - they merged and flushed with
+    glFlushMappedBufferRange() right before unmapping.
+
+    @code{.cpp}
+    buffer.bind();
+    {
+        auto mapping = buffer.map(0, size, GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+        if(mapping.isOk())
+        {
+            Vertex* vertices = mapping.data<Vertex>();
+            // ... fill some vertices
+            mapping.markDirty(first * sizeof(Vertex), count * sizeof(Vertex));
+        }
+    } // <-- flushed & unmapped here
+    @endcode
+*/
+class BufferMapping
+{
+public:
+
+    struct Range
+    {
+        size_t offset; // Relative to the beginning of mapping
+        size_t length;
+    };
+
+private:
+
+    Buffer* _buffer;
+
+    void*  _pointer;
+    long   _offset;
+    size_t _length;
+    int    _access;
+
+    std::vector<Range> _dirty_ranges;
+
+public:
+
+    BufferMapping();
+    BufferMapping(Buffer* buffer, long offset, size_t length, int access);
+    ~BufferMapping();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable (not default - moved-from mapping must not unmap)
+    BufferMapping(BufferMapping&& other);
+    BufferMapping& operator = (BufferMapping&& other);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(BufferMapping);
+
+    // -------------------------------------------------------------------------
+
+    /// Typed view on mapped memory
+    template <typename T>
+    inline T* data() const {
+        return static_cast<T*>(_pointer);
+    }
+
+    /// Count of whole `T` items, fitting into mapped range
+    template <typename T>
+    inline size_t count() const {
+        return (_length / sizeof(T));
+    }
+
+    // -------------------------------------------------------------------------
+
+    /// Records modified sub-range (relative to the beginning of mapping).
+    /// Makes sense only in case of GL_MAP_FLUSH_EXPLICIT_BIT.
+    void markDirty(size_t offset, size_t length);
+
+    /// Copies 'data' into mapped memory and marks that range as dirty
+    void write(size_t offset, const void* data, size_t length);
+
+    template <typename T>
+    inline void writeItems(size_t first, const T* items, size_t count) {
+        write(first * sizeof(T), items, count * sizeof(T));
+    }
+
+    /// Flushes recorded dirty ranges (merged), without unmapping
+    void flush();
+
+    /// Flushes (if needed) and unmaps. Returns false, if buffer contents
+    /// became corrupt while it was mapped.
+    bool unmap();
+
+    // -------------------------------------------------------------------------
+
+    void* getPointer() const;
+    long getOffset() const;
+    size_t getLength() const;
+    int getAccess() const;
+
+    const std::vector<Range>& getDirtyRanges() const;
+
+    bool isOk() const;
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <cstddef> // for size_t
+#include <map>
+#include <memory>  // for std::unique_ptr<T>
+#include <tuple>   // for std::tuple<T...>
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Pool, that recycles buffers (names & allocated storage) for
+           transient geometry.
+
+    Buffers grouped by (target, usage, size class), where size class is
+    requested size, rounded up to power of two. Released buffer kept in pool
+    for configured count of frames, and then deleted.
+
+    Storage of acquired buffer already allocated (with capacity of its size
+    class), but its content is undefined - fill it via setSubDataRaw() or
+    mapping.
+
+    @code{.cpp}
+    gl::BufferPool pool;
+
+    // Each frame:
+    auto entry = pool.acquire(GL_ARRAY_BUFFER, GL_STREAM_DRAW, sizeof(vertices));
+    entry.buffer->bind();
+    entry.buffer->setSubDataRaw(0, sizeof(vertices), vertices);
+    // ... draw
+    pool.release( std::move(entry) );
+
+    pool.nextFrame();
+    @endcode
+*/
+class BufferPool
+{
+public:
+
+    struct Entry
+    {
+        std::unique_ptr<Buffer> buffer;
+        int    usage;
+        size_t capacity; // Size of allocated storage (size class)
+
+        inline bool isOk() const { return (buffer != nullptr); }
+    };
+
+    struct Stats
+    {
+        size_t hits;      // Acquired from pool
+        size_t misses;    // Created
+        size_t evictions; // Deleted after being idle for too long
+    };
+
+private:
+
+    using key_t = std::tuple<int, int, size_t>; // (target, usage, capacity)
+
+    struct IdleBuffer
+    {
+        std::unique_ptr<Buffer> buffer;
+        size_t released_frame;
+    };
+
+    std::map<key_t, std::vector<IdleBuffer> > _idle;
+
+    size_t _max_idle_frames;
+    size_t _min_size_class;
+
+    size_t _frame;
+
+    Stats _stats;
+
+public:
+
+    BufferPool(size_t max_idle_frames = 3, size_t min_size_class = 256);
+    virtual ~BufferPool();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(BufferPool);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(BufferPool);
+
+    // -------------------------------------------------------------------------
+
+    Entry acquire(int target, int usage, size_t size);
+
+    void release(Entry&& entry);
+
+    /// Advances frame counter and deletes buffers, idle for too long
+    void nextFrame();
+
+    /// Deletes all idle buffers
+    void clear();
+
+    // -------------------------------------------------------------------------
+
+    size_t getSizeClass(size_t size) const;
+
+    size_t getIdleCount() const;
+
+    const Stats& getStats() const;
+    void resetStats();
+};
+
+} // namespace gl
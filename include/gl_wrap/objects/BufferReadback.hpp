@@ -0,0 +1,85 @@
+#pragma once
+
+#include <gl_wrap/objects/Fence.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <memory>  // for std::unique_ptr<T>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+class Buffer;
+
+/**
+    @brief Handle of asynchronous buffer read, returned by
+           gl::Buffer::readAsync().
+
+    Requested range copied GPU-side into staging buffer and guarded by fence.
+    Caller polls isReady() (or blocks via wait()), and only then staging
+    buffer mapped and copied into caller-provided destination.
+
+    Not a `std::future<T>` - OpenGL calls must be made from context thread,
+    so result must be collected there.
+
+    @code{.cpp}
+    gl::BufferReadback readback = buffer.readAsync(0, sizeof(histogram));
+
+    // ... later frames
+    if(readback.tryRead(histogram))
+    {
+        // histogram is ready
+    }
+    @endcode
+*/
+class BufferReadback
+{
+    std::unique_ptr<Buffer> _staging;
+
+    Fence _fence;
+
+    size_t _size;
+
+public:
+
+    BufferReadback();
+    BufferReadback(Buffer& source, long offset, size_t size);
+    ~BufferReadback();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    BufferReadback(BufferReadback&& other);
+    BufferReadback& operator = (BufferReadback&& other);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(BufferReadback);
+
+    // -------------------------------------------------------------------------
+
+    /// Non-blocking check, is data already copied by GPU
+    bool isReady() const;
+
+    /// Blocks until data copied by GPU. Returns false in case of error.
+    bool wait();
+
+    /// Copies data into 'destination' (at least getSize() bytes), if it is
+    /// ready. Returns false (without blocking), if it is not ready yet.
+    bool tryRead(void* destination);
+
+    /// Same as tryRead(), but blocks until data ready
+    bool read(void* destination);
+
+    // -------------------------------------------------------------------------
+
+    size_t getSize() const;
+
+    /// False for default-constructed or moved-from handle
+    bool isOk() const;
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t, int32_t
+#include <vector>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 0) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+
+/// Layout defined by GL, see glDrawArraysIndirect()
+struct DrawArraysIndirectCommand
+{
+    uint32_t count;
+    uint32_t instance_count;
+    uint32_t first;
+    uint32_t base_instance; // Must be 0 in OpenGL ES & OpenGL < 4.2
+};
+
+/// Layout defined by GL, see glDrawElementsIndirect()
+struct DrawElementsIndirectCommand
+{
+    uint32_t count;
+    uint32_t instance_count;
+    uint32_t first_index;
+    int32_t  base_vertex;
+    uint32_t base_instance; // Must be 0 in OpenGL ES & OpenGL < 4.2
+};
+
+/**
+    @brief Buffer with GL_DRAW_INDIRECT_BUFFER target - collects draw commands
+      on CPU, uploads them in bulk, and submits all of them by single
+      glMultiDraw*Indirect() call (OpenGL 4.3+).
+
+    Without glMultiDraw*Indirect() (OpenGL 4.0 - 4.2, OpenGL ES 3.1), falls back
+    to loop of glDraw*Indirect() calls over the same buffer.
+
+    Elements commands are stored first, arrays commands - right after them.
+
+    @code{.cpp}
+    gl::DrawIndirectBuffer commands(GL_DYNAMIC_DRAW);
+
+    for(const Mesh& mesh : meshes)
+        commands.addElements(mesh.index_count, 1, mesh.first_index, mesh.base_vertex);
+
+    commands.upload();
+
+    vao.bind(); // With GL_ELEMENT_ARRAY_BUFFER
+    commands.drawElements(GL_TRIANGLES, GL_UNSIGNED_INT);
+    @endcode
+*/
+class DrawIndirectBuffer
+{
+    Buffer _buffer;
+    int    _usage;
+    size_t _capacity; // In bytes
+
+    std::vector<DrawElementsIndirectCommand> _elements_commands;
+    std::vector<DrawArraysIndirectCommand>   _arrays_commands;
+
+    // Counts at moment of last upload()
+    size_t _uploaded_elements_count;
+    size_t _uploaded_arrays_count;
+
+public:
+
+    DrawIndirectBuffer(int usage);
+    virtual ~DrawIndirectBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(DrawIndirectBuffer);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(DrawIndirectBuffer);
+
+    // -------------------------------------------------------------------------
+
+    void addElements(uint32_t count, uint32_t instance_count = 1,
+                     uint32_t first_index = 0, int32_t base_vertex = 0,
+                     uint32_t base_instance = 0);
+    void addElements(const DrawElementsIndirectCommand& command);
+
+    void addArrays(uint32_t count, uint32_t instance_count = 1,
+                   uint32_t first = 0, uint32_t base_instance = 0);
+    void addArrays(const DrawArraysIndirectCommand& command);
+
+    /// Removes CPU-side commands (uploaded ones still can be drawn)
+    void clear();
+
+    // -------------------------------------------------------------------------
+
+    /// Uploads all commands to buffer. Storage re-specified only on growth.
+    void upload();
+
+    /// 'type' - type of indices: GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or
+    /// GL_UNSIGNED_INT. VAO with element buffer must be binded.
+    void drawElements(int mode, int type);
+
+    void drawArrays(int mode);
+
+    // -------------------------------------------------------------------------
+
+    size_t getElementsCommandsCount() const;
+    size_t getArraysCommandsCount() const;
+
+    Buffer& getBuffer();
+};
+
+#endif
+
+} // namespace gl
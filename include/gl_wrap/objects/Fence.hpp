@@ -0,0 +1,75 @@
+#pragma once
+
+#include <gl_wrap/utils/macros.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstdint> // for uint64_t
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+/**
+    @brief Wrapper over 'sync object' (glFenceSync()).
+
+    Not derived from gl::Object, since sync objects identified by pointer
+    (GLsync), not by integer name (GLuint).
+*/
+class Fence
+{
+public:
+
+    using handle_t = void*; // Aka GLsync
+
+private:
+
+    handle_t _handle;
+
+public:
+
+    Fence();
+    ~Fence();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable (not default - moved-from fence must not delete handle)
+    Fence(Fence&& other);
+    Fence& operator = (Fence&& other);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(Fence);
+
+    // -------------------------------------------------------------------------
+
+    /// Inserts new fence into command stream (previous one, if any, deleted)
+    void insert();
+
+    /// Deletes fence (if inserted)
+    void reset();
+
+    bool isInserted() const;
+
+    // -------------------------------------------------------------------------
+
+    /// Non-blocking check. Not inserted fence treated as signaled.
+    bool isSignaled() const;
+
+    /// Returns one of: GL_ALREADY_SIGNALED, GL_CONDITION_SATISFIED,
+    /// GL_TIMEOUT_EXPIRED, GL_WAIT_FAILED
+    int clientWait(uint64_t timeout_ns);
+
+    /// Blocks until fence signaled. Returns false in case of GL_WAIT_FAILED.
+    bool wait();
+
+    /// Makes server (GPU) wait for fence, without blocking client
+    void serverWait();
+
+    // -------------------------------------------------------------------------
+
+    handle_t getHandle() const;
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <memory>  // for std::unique_ptr<T>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0)) // Requires glCopyBufferSubData()
+
+/**
+    @brief Untyped (bytes-level) part of gl::GpuVector<T>.
+
+    On reallocation capacity grows geometrically (x2), and old content copied
+    GPU-side (glCopyBufferSubData()), so CPU never re-uploads it.
+
+    NOTE: reallocation replaces underlying buffer (its id changes), so
+      dependent state (VAO attribute bindings, etc) must be re-specified -
+      check getReallocationsCount().
+*/
+class GpuVectorBase
+{
+    int _target;
+    int _usage;
+
+    std::unique_ptr<Buffer> _buffer;
+
+    size_t _size;     // In bytes
+    size_t _capacity; // In bytes
+
+    size_t _reallocations_count;
+
+public:
+
+    GpuVectorBase(int target, int usage, size_t initial_capacity = 0);
+    virtual ~GpuVectorBase();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(GpuVectorBase);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(GpuVectorBase);
+
+    // -------------------------------------------------------------------------
+
+    void reserveBytes(size_t capacity);
+
+    void appendBytes(const void* data, size_t size);
+
+    /// Overwrites already appended bytes (range must be inside of size)
+    void setBytes(size_t offset, const void* data, size_t size);
+
+    void resizeBytes(size_t size);
+
+    void clear();
+
+    // -------------------------------------------------------------------------
+
+    size_t getSizeBytes() const;
+    size_t getCapacityBytes() const;
+
+    size_t getReallocationsCount() const;
+
+    Buffer& getBuffer();
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief GPU-side analogue of `std::vector<T>` with amortized O(1) appends.
+
+    @code{.cpp}
+    gl::GpuVector<Point> points(GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW);
+
+    points.reserve(1024);
+    points.push_back(point);
+    points.append(new_points, new_points_count);
+
+    // ... draw `points.size()` points from `points.getBuffer()`
+    @endcode
+*/
+template <typename T>
+class GpuVector : public GpuVectorBase
+{
+public:
+
+    GpuVector(int target, int usage, size_t initial_capacity = 0)
+        : GpuVectorBase(target, usage, initial_capacity * sizeof(T))
+    {}
+
+    // -------------------------------------------------------------------------
+
+    inline void reserve(size_t count) {
+        reserveBytes(count * sizeof(T));
+    }
+
+    inline void push_back(const T& item) {
+        appendBytes(&item, sizeof(T));
+    }
+
+    inline void append(const T* items, size_t count) {
+        appendBytes(items, count * sizeof(T));
+    }
+
+    template <size_t SIZE>
+    inline void appendArray(const T(&array)[SIZE]) {
+        append(array, SIZE);
+    }
+
+    inline void set(size_t index, const T& item) {
+        setBytes(index * sizeof(T), &item, sizeof(T));
+    }
+
+    inline void resize(size_t count) {
+        resizeBytes(count * sizeof(T));
+    }
+
+    // -------------------------------------------------------------------------
+
+    inline size_t size() const {
+        return getSizeBytes() / sizeof(T);
+    }
+
+    inline size_t capacity() const {
+        return getCapacityBytes() / sizeof(T);
+    }
+
+    inline bool empty() const {
+        return (getSizeBytes() == 0);
+    }
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <gl_wrap/objects/OrphaningBuffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint8_t
+#include <vector>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 3) || GLWRAP_GL_FROM_GLES_VER(3, 0)) // Requires glVertexAttribDivisor()
+
+/**
+    @brief Untyped (bytes-level) part of gl::InstanceStream<T>.
+
+    Per frame: clear(), push instances, upload() (buffer is orphaned, so
+    previous frame's draws are not stalled), then draw*Instanced().
+*/
+class InstanceStreamBase
+{
+    OrphaningBuffer _stream; // Grows to the biggest uploaded set
+    size_t          _instance_size;
+
+    std::vector<uint8_t> _staging;
+    size_t               _uploaded_count;
+
+public:
+
+    InstanceStreamBase(size_t instance_size, int usage);
+    virtual ~InstanceStreamBase();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(InstanceStreamBase);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(InstanceStreamBase);
+
+    // -------------------------------------------------------------------------
+
+    /// Starts staging of new set of instances
+    void clear();
+
+    void pushRaw(const void* instances, size_t count);
+
+    void upload();
+
+    // -------------------------------------------------------------------------
+
+    /// Draws uploaded instances. VAO with layout, sourcing per-instance
+    /// attributes from getBuffer(), must be binded.
+    void drawArrays(int mode, int first, int count);
+    void drawElements(int mode, int count, int type, size_t offset = 0);
+
+    // -------------------------------------------------------------------------
+
+    size_t getStagedCount() const;
+    size_t getUploadedCount() const;
+
+    Buffer& getBuffer();
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Per-instance data stream (transforms, tints, sub-rects, etc).
+
+    @code{.cpp}
+    gl::InstanceStream<Instance> instances(GL_STREAM_DRAW);
+
+    layout.addInstanced<Instance>(1, { ... });
+    gl::Buffer* buffers[] = { &mesh_vertices, &instances.getBuffer() };
+    vao.apply(layout, buffers);
+
+    // Each frame
+    instances.clear();
+    for(const Sprite& sprite : sprites)
+        instances.push(sprite.instance);
+    instances.upload();
+
+    vao.bind();
+    instances.drawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT);
+    @endcode
+*/
+template <typename T>
+class InstanceStream : public InstanceStreamBase
+{
+public:
+
+    InstanceStream(int usage)
+        : InstanceStreamBase(sizeof(T), usage)
+    {}
+
+    // -------------------------------------------------------------------------
+
+    inline void push(const T& instance) {
+        pushRaw(&instance, 1);
+    }
+
+    inline void push(const T* instances, size_t count) {
+        pushRaw(instances, count);
+    }
+
+    template <size_t SIZE>
+    inline void pushArray(const T(&array)[SIZE]) {
+        pushRaw(array, SIZE);
+    }
+};
+
+#endif
+
+} // namespace gl
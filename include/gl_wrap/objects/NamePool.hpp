@@ -0,0 +1,148 @@
+#pragma once
+
+#include <gl_wrap/objects/Object.hpp>
+
+#include <cstddef> // for size_t
+#include <memory>  // for std::unique_ptr<T>
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Pool of pre-generated object names (ids) of single type.
+
+    Each object constructor takes its name from pool of its type (see
+    get_name_pool<T>()). When pool is empty, it refilled by single glGen*()
+    call:
+
+    - disabled pool (default) - generates 1 name, same as direct glGen*(1, ..)
+    - enabled pool - generates 'block size' names at once
+
+    NOTE: names are not deleted in destructor (pools are static, and may
+      outlive context) - call clear() before context destruction.
+*/
+class NamePool
+{
+public:
+
+    using id_t = Object::id_t;
+
+    using gen_func_t    = void (*)(int n,       id_t* ids);
+    using delete_func_t = void (*)(int n, const id_t* ids);
+
+private:
+
+    gen_func_t    _gen_func;
+    delete_func_t _delete_func;
+
+    std::vector<id_t> _names;
+
+    size_t _block_size;
+    bool   _enabled;
+
+    size_t _gen_calls_count;
+
+public:
+
+    NamePool(gen_func_t gen_func, delete_func_t delete_func, size_t block_size = 256);
+    ~NamePool();
+
+    // -------------------------------------------------------------------------
+
+    // Non-copyable & non-moveable (used via static instances)
+    GLWRAP_PREVENT_COPY_ASSIGN_AND_MOVE(NamePool);
+
+    // -------------------------------------------------------------------------
+
+    id_t acquire();
+
+    /// Makes sure, that at least 'count' names available, using single
+    /// glGen*() call (works for disabled pool too)
+    void reserve(size_t count);
+
+    /// Deletes all unused names
+    void clear();
+
+    // -------------------------------------------------------------------------
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    void setBlockSize(size_t block_size);
+    size_t getBlockSize() const;
+
+    size_t getAvailableCount() const;
+
+    /// Count of glGen*() calls, made by pool (for profiling)
+    size_t getGenCallsCount() const;
+
+private:
+
+    void generate(size_t count);
+};
+
+// -----------------------------------------------------------------------------
+
+/// Pool of names for objects of type `T`. Specializations defined along with
+/// objects: gl::Buffer, gl::Texture, gl::FrameBuffer, gl::RenderBuffer,
+/// gl::VertexArrayObject.
+template <typename T>
+NamePool& get_name_pool();
+
+class Buffer;
+class Texture;
+class FrameBuffer;
+class RenderBuffer;
+class VertexArrayObject;
+
+template <> NamePool& get_name_pool<Buffer>();
+template <> NamePool& get_name_pool<Texture>();
+template <> NamePool& get_name_pool<FrameBuffer>();
+template <> NamePool& get_name_pool<RenderBuffer>();
+template <> NamePool& get_name_pool<VertexArrayObject>();
+
+/// Whether constructor of `T` takes its name from pool now (textures don't,
+/// when DSA is used - glCreateTextures() creates them for exact target)
+template <typename T>
+inline bool is_name_pool_used()
+{
+    return true;
+}
+
+template <> bool is_name_pool_used<Texture>();
+
+/// Enables/disables pools for all object types at once
+void set_name_pools_enabled(bool enabled);
+
+/// Deletes unused names in pools for all object types
+void clear_name_pools();
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Constructs 'count' objects, with single glGen*() call for all of
+           their names (if they are taken from pool, see is_name_pool_used()).
+
+    @code{.cpp}
+    auto buffers = gl::make_objects<gl::Buffer>(1000, GL_ARRAY_BUFFER);
+    @endcode
+*/
+template <typename T, typename ... Args>
+std::vector< std::unique_ptr<T> > make_objects(size_t count, Args&& ... args)
+{
+    if(is_name_pool_used<T>())
+    {
+        get_name_pool<T>().reserve(count);
+    }
+
+    std::vector< std::unique_ptr<T> > objects;
+    objects.reserve(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        // Not forwarded - same arguments are used for each object
+        objects.emplace_back( new T(args...) );
+    }
+    return objects;
+}
+
+} // namespace gl
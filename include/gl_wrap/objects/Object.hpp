@@ -21,8 +21,11 @@ public:
 
     // -------------------------------------------------------------------------
 
-    // Moveable
-    GLWRAP_MOVE_DEFAULT(Object);
+    // Moveable: name is taken from 'other' (it's left with 0, which is
+    // ignored by glDelete*()). On assignment, names are swapped - so own old
+    // name is deleted along with 'other'
+    Object(Object&& other);
+    Object& operator = (Object&& other);
 
     // Non-copyable
     GLWRAP_PREVENT_COPY_AND_ASSIGN(Object);
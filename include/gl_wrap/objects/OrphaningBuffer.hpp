@@ -0,0 +1,95 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+/**
+    @brief Streaming buffer for targets without glBufferStorage() (GLES 3.x).
+
+    Data appended into buffer via unsynchronized glMapBufferRange() writes.
+    When write cursor reaches the end of buffer, storage 'orphaned' (by
+    glBufferData() with nullptr and same size/usage), so driver hands out new
+    memory block instead of waiting for GPU, which may still read previous one.
+
+    Buffer size tracked on CPU side, so no glGetBufferParameteriv() round-trip
+    is needed.
+
+    @code{.cpp}
+    gl::OrphaningBuffer stream(GL_ARRAY_BUFFER, 1024 * 1024, GL_STREAM_DRAW);
+
+    const long offset = stream.append(vertices, sizeof(vertices), alignof(float));
+    if(offset >= 0)
+    {
+        // ... draw using `stream.getBuffer()` and `offset`
+    }
+    @endcode
+*/
+class OrphaningBuffer
+{
+    Buffer _buffer;
+
+    size_t _size;
+    int    _usage;
+
+    size_t _head; // Write cursor
+
+    size_t _orphans_count;
+
+public:
+
+    OrphaningBuffer(int target, size_t size, int usage);
+    virtual ~OrphaningBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(OrphaningBuffer);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(OrphaningBuffer);
+
+    // -------------------------------------------------------------------------
+
+    /// Copies 'data' into buffer. Returns offset of copied data from the
+    /// beginning of buffer, or -1 in case of error (size is bigger than whole
+    /// buffer, or mapping failed). Buffer left binded.
+    long append(const void* data, size_t size, size_t alignment = 1);
+
+    template <typename T>
+    inline long appendItems(const T* items, size_t count) {
+        return append(items, (count * sizeof(T)), alignof(T));
+    }
+
+    /// Reserves 'size' bytes and maps them for writing (unsynchronized), so
+    /// producer may write directly into driver memory. Offset of reserved
+    /// range returned via 'offset' (-1 in case of error).
+    BufferMapping appendMapping(size_t size, size_t alignment, long& offset);
+
+    /// Forces orphaning of current storage (write cursor reset)
+    void orphan();
+
+    /// Orphans current storage, replacing it by one of new size
+    void resize(size_t size);
+
+    // -------------------------------------------------------------------------
+
+    Buffer& getBuffer();
+
+    size_t getSize() const;
+    int getUsage() const;
+    size_t getUsedSize() const;
+
+    /// Count of orphaning since creation (for profiling)
+    size_t getOrphansCount() const;
+};
+
+#endif
+
+} // namespace gl
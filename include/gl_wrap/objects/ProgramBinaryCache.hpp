@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint64_t
+#include <string>
+
+namespace gl {
+
+class ShaderProgram;
+
+/**
+    @brief On-disk cache of linked program binaries (glGetProgramBinary() /
+      glProgramBinary()), to skip shaders compilation on next launches.
+
+    Entry key is hash of final source strings of all stages & of driver
+    identity (GL_VENDOR, GL_RENDERER, GL_VERSION - the last one contains
+    driver build on most drivers), so driver update invalidates all entries.
+
+    Entries are written atomically (temporary file + rename), so concurrent
+    processes never see partially written file, and read through mmap()
+    (plain read on Windows). Entry, rejected by driver or damaged, is
+    removed - caller falls back to compilation from sources (see
+    make_program_cached()).
+
+    @code{.cpp}
+    gl::ProgramBinaryCache cache("/var/cache/app/shaders");
+
+    gl::ShaderProgram program;
+    gl::make_program_cached(cache, "sprite", program, vertex_src, fragment_src);
+    @endcode
+*/
+class ProgramBinaryCache
+{
+    std::string _directory;
+    std::string _driver_id;
+    bool        _is_supported;
+
+    size_t _hits_count;
+    size_t _misses_count;
+    size_t _rejected_count;
+
+public:
+
+    /// Must be created with current context (driver strings are queried).
+    /// Directory is created, if not exists (only last level)
+    explicit ProgramBinaryCache(const std::string& directory);
+
+    // -------------------------------------------------------------------------
+
+    uint64_t makeKey(const char** vertex_sources,   int vertex_sources_count,
+                     const char** fragment_sources, int fragment_sources_count) const;
+
+    /// Returns true, if program linked from cached binary
+    bool load(uint64_t key, ShaderProgram& program);
+
+    /// Saves binary of linked program (program must be linked with
+    /// ShaderProgram::setBinaryRetrievableHint(true))
+    bool store(uint64_t key, const ShaderProgram& program);
+
+    void remove(uint64_t key);
+
+    // -------------------------------------------------------------------------
+
+    bool isSupported() const;
+
+    /// Misses - no entry, rejected - entry was damaged or rejected by driver
+    size_t getHitsCount() const;
+    size_t getMissesCount() const;
+    size_t getRejectedCount() const;
+
+    std::string getEntryPath(uint64_t key) const;
+};
+
+} // namespace gl
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
+#include <string>
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Snapshot of linked program interface: active attributes, uniforms,
+      uniform blocks & shader storage blocks (both with members layout).
+
+    Built once by ShaderProgram::link(), so consumers (locations cache,
+    layouts validation, VAO/UBO setup) need no more GL queries. All names
+    are stored in single pool of null-terminated strings, records refer to
+    them by offset (see getString()).
+
+    Uniform blocks data requires OpenGL 3.1 / ES 3.0, storage blocks -
+    OpenGL 4.3 / ES 3.1 (on lower versions these lists are empty).
+*/
+class ProgramReflection
+{
+public:
+
+    struct Attribute
+    {
+        uint32_t name;     // Offset in strings pool
+        int      type;     // GL_FLOAT_VEC3, etc.
+        int      size;     // Array size
+        int      location;
+    };
+
+    struct Uniform
+    {
+        uint32_t name;           // Offset in strings pool ("array[0]" for arrays)
+        int      type;           // GL_FLOAT_MAT4, GL_SAMPLER_2D, etc.
+        int      size;           // Array size
+        int      location;       // -1 - block member
+        uint32_t first_element;  // In element locations (see getElementLocation())
+
+        // Block members only (otherwise -1)
+        int      block_index;
+        int      offset;
+        int      array_stride;
+        int      matrix_stride;
+        bool     is_row_major;
+    };
+
+    struct UniformBlock
+    {
+        uint32_t name;          // Offset in strings pool
+        unsigned int index;
+        unsigned int binding;
+        size_t   data_size;
+        uint32_t first_member;  // In block members (see getBlockMember())
+        uint32_t members_count;
+    };
+
+    struct StorageBlock
+    {
+        uint32_t name;          // Offset in strings pool
+        unsigned int index;
+        unsigned int binding;
+        size_t   data_size;     // For runtime-sized array - one element counted
+        uint32_t first_member;  // In buffer variables (see getStorageBlockMember())
+        uint32_t members_count;
+    };
+
+    /// Member of storage block
+    struct BufferVariable
+    {
+        uint32_t name;                   // Offset in strings pool ("items[0].color", etc)
+        int      type;                   // GL_FLOAT_VEC4, etc.
+        int      size;                   // Array size (0 - runtime-sized)
+        int      block_index;            // Index of storage block
+        int      offset;
+        int      array_stride;
+        int      matrix_stride;
+        bool     is_row_major;
+        int      top_level_array_size;   // 0 - runtime-sized
+        int      top_level_array_stride;
+    };
+
+private:
+
+    std::vector<Attribute>      _attributes;
+    std::vector<Uniform>        _uniforms;
+    std::vector<int>            _element_locations; // Per uniform: 'size' locations
+    std::vector<UniformBlock>   _uniform_blocks;
+    std::vector<uint32_t>       _block_members;     // Indices in '_uniforms'
+    std::vector<StorageBlock>   _storage_blocks;
+    std::vector<BufferVariable> _buffer_variables;  // Grouped by storage block
+    std::string                 _strings;
+
+public:
+
+    ProgramReflection();
+
+    // -------------------------------------------------------------------------
+
+    /// Queries everything from linked program
+    void build(unsigned int program_id);
+    void clear();
+
+    // -------------------------------------------------------------------------
+
+    const std::vector<Attribute>&    getAttributes() const;
+    const std::vector<Uniform>&      getUniforms() const;
+    const std::vector<UniformBlock>& getUniformBlocks() const;
+    const std::vector<StorageBlock>& getStorageBlocks() const;
+    const std::vector<BufferVariable>& getBufferVariables() const;
+
+    const char* getString(uint32_t offset) const;
+
+    /// Location of element of uniform array (-1 for block members)
+    int getElementLocation(const Uniform& uniform, int element_index) const;
+
+    const Uniform& getBlockMember(const UniformBlock& block, uint32_t member_index) const;
+
+    const BufferVariable& getStorageBlockMember(const StorageBlock& block, uint32_t member_index) const;
+
+    /// Keep cached bindings in sync after glUniformBlockBinding() /
+    /// glShaderStorageBlockBinding() (unknown 'block_index' is ignored)
+    void setUniformBlockBinding(unsigned int block_index, unsigned int binding);
+    void setStorageBlockBinding(unsigned int block_index, unsigned int binding);
+
+    // -------------------------------------------------------------------------
+
+    /// Returns nullptr, if not found. Arrays are found both by "name" &
+    /// "name[0]"
+    const Attribute*    findAttribute(const char* name) const;
+    const Uniform*      findUniform(const char* name) const;
+    const UniformBlock* findUniformBlock(const char* name) const;
+    const StorageBlock* findStorageBlock(const char* name) const;
+    const BufferVariable* findBufferVariable(const char* name) const;
+};
+
+} // namespace gl
@@ -1,7 +1,16 @@
 #pragma once
 
 #include <gl_wrap/objects/Object.hpp>
+#include <gl_wrap/objects/ProgramReflection.hpp>
 #include <gl_wrap/objects/Shader.hpp>
+#include <gl_wrap/objects/UniformId.hpp>
+#include <gl_wrap/objects/UniformLocationCache.hpp>
+#include <gl_wrap/objects/UniformValueCache.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
 
 #include <string>
 #include <vector>
@@ -47,6 +56,30 @@ namespace gl {
 
 class ShaderProgram : public Object
 {
+    // Active interface, queried once on link()
+    ProgramReflection _reflection;
+
+    // Name -> location, filled on link() & on first lookup of each name
+    mutable UniformLocationCache _uniform_locations;
+
+    // UniformId -> location, direct-mapped by name hash, so setUniform(UniformId)
+    // costs single comparison after first resolution (see resolveUniform())
+    struct ResolvedUniform
+    {
+        const char* name;    // Pointer of UniformId::name; nullptr - empty slot
+        uint32_t    hash;
+        int         gl_type; // Same name may be used with another type
+        int         location;
+    };
+
+    static constexpr size_t RESOLVED_UNIFORMS_COUNT = 64; // Power of 2
+
+    ResolvedUniform _resolved_uniforms[RESOLVED_UNIFORMS_COUNT];
+
+    // Location -> last set values (opt-in), to skip redundant glUniform*()
+    UniformValueCache _uniform_values;
+    bool              _is_uniform_values_cache_enabled;
+
 public:
 
     ShaderProgram();
@@ -68,9 +101,26 @@ public:
     void detachShader(unsigned int shader_id);
     void detachShader(const Shader* shader);
 
+    /// Also builds reflection & fills uniform locations cache from it
     void link();
     void validate();
 
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Program binary (OpenGL 4.1 / ES 3.0, or ARB/OES_get_program_binary)
+
+    /// False, if functions not available or driver has no binary formats
+    static bool isBinarySupported();
+
+    /// Must be set before link(), to be able to get binary (ignored on GLES2)
+    void setBinaryRetrievableHint(bool is_retrievable);
+
+    /// Empty, if not linked or not supported
+    std::vector<unsigned char> getBinary(unsigned int& format) const;
+
+    /// Same as link(), but from binary. Driver may reject binary (other
+    /// driver version, etc.) - check isLinked() after
+    void loadBinary(unsigned int format, const void* data, size_t size);
+
     void use();
     static void unuse();
 
@@ -96,8 +146,64 @@ public:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    /// Resolved through per-program cache: GL is queried only once per name
     uniform_location getUniformLocation(const char* name) const;
 
+    /// Same, but name hash is already computed (in compile-time)
+    uniform_location getUniformLocation(const UniformName& id) const;
+
+    /// Resolve once per program, then set by handle. With GLWRAP_CHECK_UNIFORM_TYPES
+    /// type is checked against active uniform type
+    template <typename T>
+    inline UniformHandle<T> getUniformHandle(const UniformId<T>& id) const
+    {
+        const int location = getUniformLocation(static_cast<const UniformName&>(id)).location;
+        checkUniformType(id.name, location, uniform_type_traits<T>::gl_type);
+        return UniformHandle<T>(location);
+    }
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Uniform blocks
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    /// Returns GL_INVALID_INDEX, if block not present
+    unsigned int getUniformBlockIndex(const char* name) const;
+
+    void setUniformBlockBinding(unsigned int block_index, unsigned int binding);
+
+    /// Returns false, if block not present
+    bool setUniformBlockBinding(const char* name, unsigned int binding);
+
+    /// Size of block's data, as computed by driver (compare with sizeof() of
+    /// C++ struct, to catch layout mismatches)
+    size_t getUniformBlockDataSize(unsigned int block_index) const;
+#endif
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Shader storage blocks
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+    struct storage_block_info {
+        std::string  name;
+        unsigned int index;
+        unsigned int binding;
+        size_t       data_size; // For runtime-sized array - one element counted
+    };
+
+    /// Returns GL_INVALID_INDEX, if block not present
+    unsigned int getStorageBlockIndex(const char* name) const;
+
+    /// Enumerates active shader storage blocks (program must be linked)
+    std::vector<storage_block_info> getStorageBlocks() const;
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 3) // glShaderStorageBlockBinding() not present in OpenGL ES
+    void setStorageBlockBinding(unsigned int block_index, unsigned int binding);
+
+    /// Returns false, if block not present
+    bool setStorageBlockBinding(const char* name, unsigned int binding);
+#endif
+
     // -------------------------------------------------------------------------
 
     // TODO: for every 'setUniform', add debug check - is used
@@ -193,6 +299,53 @@ public:
     void setUniformMatrix3(const char* name, const float* values, bool transpose = false);
     void setUniformMatrix4(const char* name, const float* values, bool transpose = false);
 
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Arrays :: unsigned int (unsafe version for pointer-to-array)
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    void setUniformUIntArray1Ptr(uniform_location location, const unsigned int* values, int count = 1);
+    void setUniformUIntArray2Ptr(uniform_location location, const unsigned int* values, int count = 1);
+    void setUniformUIntArray3Ptr(uniform_location location, const unsigned int* values, int count = 1);
+    void setUniformUIntArray4Ptr(uniform_location location, const unsigned int* values, int count = 1);
+#endif
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Typed handles (exact glUniform*() variant is chosen in compile-time)
+
+    template <typename T>
+    inline void setUniform(const UniformHandle<T>& handle, const typename UniformHandle<T>::value_type& value)
+    {
+        setUniformValue(handle.location, value);
+    }
+
+    /// Name of 'id' must outlive the program (string literal, as usual), since
+    /// resolved location is found by its pointer
+    template <typename T>
+    inline void setUniform(const UniformId<T>& id, const typename UniformId<T>::value_type& value)
+    {
+        const int location = resolveUniform(id, uniform_type_traits<T>::gl_type);
+
+        if(location != -1)
+        {
+            setUniformValue(location, value);
+        }
+    }
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Uniform values shadowing
+
+    /// When enabled, setUniform*() calls with values equal to already set ones
+    /// are skipped (layout is taken from active uniforms on link)
+    void setUniformValuesCacheEnabled(bool is_enabled);
+    bool isUniformValuesCacheEnabled() const;
+
+    /// Must be called after values were changed bypassing this class
+    void invalidateUniformValuesCache();
+
+    /// Hits/misses counters
+    const UniformValueCache& getUniformValuesCache() const;
+    void resetUniformValuesCacheCounters();
+
     // -------------------------------------------------------------------------
 
     bool isDeleted() const;
@@ -221,6 +374,9 @@ public:
 
     bool isOk() const;
 
+    /// Active attributes, uniforms & blocks (empty, if not linked)
+    const ProgramReflection& getReflection() const;
+
     // -------------------------------------------------------------------------
     // Extentions
 
@@ -522,12 +678,65 @@ public:
     // TODO: bullet3
     //    TODO: bullet3's 'btScalar' may be float or double, it must be handled
 
+private:
+
+    /// Reflection & caches update after link (from sources or binary)
+    void onLinked();
+
+    void cacheUniformLocations();
+
+    /// Location of 'id' - resolved (type checked, missing reported) only once
+    inline int resolveUniform(const UniformName& id, int gl_type)
+    {
+        const ResolvedUniform& resolved = _resolved_uniforms[id.hash & (RESOLVED_UNIFORMS_COUNT - 1)];
+
+        if((resolved.name == id.name) && (resolved.hash == id.hash) && (resolved.gl_type == gl_type))
+        {
+            return resolved.location;
+        }
+
+        return resolveUniformSlow(id, gl_type);
+    }
+
+    int resolveUniformSlow(const UniformName& id, int gl_type);
+
+    /// Returns true, if GL call may be skipped (values cache enabled & values
+    /// not changed)
+    bool isUniformValueShadowed(int location, const void* data, size_t size);
+
+    /// Prints error once per name
+    void reportMissingUniform(const char* name);
+
+    /// Does nothing, if GLWRAP_CHECK_UNIFORM_TYPES not defined
+    void checkUniformType(const char* name, int location, int gl_type) const;
+
+    // Typed setters (see setUniform())
+    void setUniformValue(int location, float value);
+    void setUniformValue(int location, const glsl::vec2& value);
+    void setUniformValue(int location, const glsl::vec3& value);
+    void setUniformValue(int location, const glsl::vec4& value);
+
+    void setUniformValue(int location, int value);
+    void setUniformValue(int location, const glsl::ivec2& value);
+    void setUniformValue(int location, const glsl::ivec3& value);
+    void setUniformValue(int location, const glsl::ivec4& value);
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    void setUniformValue(int location, unsigned int value);
+    void setUniformValue(int location, const glsl::uvec2& value);
+    void setUniformValue(int location, const glsl::uvec3& value);
+    void setUniformValue(int location, const glsl::uvec4& value);
+#endif
+
+    void setUniformValue(int location, bool value);
+
+    void setUniformValue(int location, const glsl::mat2& value);
+    void setUniformValue(int location, const glsl::mat3& value);
+    void setUniformValue(int location, const glsl::mat4& value);
 };
 
 const char* get_shader_variable_type_str(int type);
 
-// TODO: https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glGetActiveAttrib.xml
-// TODO: https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glGetActiveUniform.xml
 // TODO: https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glGetUniform.xml
 
 } // namespace gl
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef>     // for size_t
+#include <type_traits> // for std::is_standard_layout<T>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+
+/**
+    @brief Buffer with GL_SHADER_STORAGE_BUFFER target, to feed
+      `layout(std430) buffer` blocks (see utils/std430.hpp for layout checks).
+
+    Storage blocks are not limited by GL_MAX_UNIFORM_BLOCK_SIZE, so large
+    per-instance datasets (transforms, etc) can be passed.
+
+    @code{.cpp}
+    // layout(std430, binding = 0) buffer Instances { uint count; mat4 transforms[]; };
+    // Aligned as mat4, since array starts at sizeof(InstancesHeader)
+    struct alignas(16) InstancesHeader
+    {
+        gl::std430::uint count;
+    };
+
+    GLWRAP_STD430_CHECK_TRAILING(InstancesHeader, count, gl::std430::mat4);
+
+    gl::ShaderStorageBuffer ssbo(GL_DYNAMIC_DRAW);
+
+    ssbo.setHeaderAndArray(header, transforms, transforms_count);
+    ssbo.bindBase(0);
+    @endcode
+*/
+class ShaderStorageBuffer
+{
+    Buffer _buffer;
+    int    _usage;
+    size_t _size;
+
+public:
+
+    ShaderStorageBuffer(int usage, size_t size = 0);
+    virtual ~ShaderStorageBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(ShaderStorageBuffer);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(ShaderStorageBuffer);
+
+    // -------------------------------------------------------------------------
+
+    /// Re-specifies storage (content becomes undefined), if size changed
+    void resize(size_t size);
+
+    void setDataRaw(size_t size, const void* data);
+    void setSubDataRaw(long offset, size_t size, const void* data);
+
+    /// Uploads fixed part & runtime-sized trailing array (starting at
+    /// sizeof(Header)). Storage re-specified only if total size changed.
+    template <typename Header, typename Element>
+    inline void setHeaderAndArray(const Header& header, const Element* items, size_t count)
+    {
+        static_assert(std::is_standard_layout<Header>::value, "Storage block type must have standard layout");
+
+        resize(sizeof(Header) + count * sizeof(Element));
+        setSubDataRaw(0, sizeof(Header), &header);
+        setSubDataRaw(sizeof(Header), count * sizeof(Element), items);
+    }
+
+    /// Uploads runtime-sized array only (block without fixed part)
+    template <typename Element>
+    inline void setArray(const Element* items, size_t count)
+    {
+        setDataRaw(count * sizeof(Element), items);
+    }
+
+    // -------------------------------------------------------------------------
+
+    void bindBase(unsigned int binding);
+
+    /// 'offset' must be multiple of getOffsetAlignment()
+    void bindRange(unsigned int binding, long offset, size_t size);
+
+    // -------------------------------------------------------------------------
+
+    size_t getSize() const;
+
+    Buffer& getBuffer();
+
+    // -------------------------------------------------------------------------
+
+    static int getOffsetAlignment();
+    static int getMaxBlockSize();
+    static int getMaxBindings();
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <cstddef> // for size_t
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Buffer with CPU-side copy ('shadow') of its content.
+
+    Writes go into shadow copy and recorded as dirty intervals. On flush()
+    intervals sorted & merged (adjacent ones, or separated by gap not bigger
+    than 'gap threshold'), and uploaded via minimal count of
+    glBufferSubData() calls.
+
+    Bigger gap threshold means less calls, but more re-uploaded (unchanged)
+    bytes - FlushReport helps to tune it.
+
+    @code{.cpp}
+    gl::ShadowedBuffer shadowed(GL_ARRAY_BUFFER, sizeof(particles), GL_DYNAMIC_DRAW, 256);
+
+    // Scattered updates
+    shadowed.writeItems(i, &particles[i], 1);
+    shadowed.writeItems(j, &particles[j], 1);
+
+    // Once per frame
+    const auto& report = shadowed.flush();
+    @endcode
+*/
+class ShadowedBuffer
+{
+public:
+
+    struct FlushReport
+    {
+        size_t bytes_written;  // Sum of sizes of all writes since previous flush
+        size_t bytes_uploaded; // Actually uploaded (merged intervals, including gaps)
+        size_t uploads_count;  // Count of glBufferSubData() calls
+    };
+
+private:
+
+    struct Interval
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    Buffer _buffer;
+
+    std::vector<unsigned char> _shadow;
+    std::vector<Interval>      _dirty;
+
+    size_t _gap_threshold;
+    size_t _bytes_written;
+
+    FlushReport _last_report;
+
+public:
+
+    ShadowedBuffer(int target, size_t size, int usage, size_t gap_threshold = 0);
+    virtual ~ShadowedBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(ShadowedBuffer);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(ShadowedBuffer);
+
+    // -------------------------------------------------------------------------
+
+    void write(size_t offset, const void* data, size_t size);
+
+    template <typename T>
+    inline void writeItems(size_t first, const T* items, size_t count) {
+        write(first * sizeof(T), items, count * sizeof(T));
+    }
+
+    /// Direct access to shadow copy. Modified bytes must be reported via
+    /// markDirty().
+    unsigned char* getData();
+    const unsigned char* getData() const;
+
+    void markDirty(size_t offset, size_t size);
+
+    /// Uploads dirty intervals into buffer (buffer left binded)
+    const FlushReport& flush();
+
+    // -------------------------------------------------------------------------
+
+    void setGapThreshold(size_t gap_threshold);
+    size_t getGapThreshold() const;
+
+    const FlushReport& getLastFlushReport() const;
+
+    size_t getSize() const;
+    bool isDirty() const;
+
+    Buffer& getBuffer();
+};
+
+} // namespace gl
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+#include <gl_wrap/objects/Fence.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef> // for size_t
+#include <vector>
+
+namespace gl {
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 4) // Requires glBufferStorage()
+
+/**
+    @brief Persistently-mapped buffer for per-frame streaming of dynamic data.
+
+    Storage is split into N equal 'regions' (one per frame in flight). Each
+    region guarded by fence, so CPU never writes into memory, that GPU still
+    reads. Inside of region memory handed out by bump-pointer, so upload is a
+    plain `memcpy()` without any driver call.
+
+    @code{.cpp}
+    gl::StreamingRingBuffer ring(GL_ARRAY_BUFFER, 4 * 1024 * 1024);
+
+    // Each frame:
+    ring.beginFrame();
+    {
+        const auto alloc = ring.allocate(sizeof(vertices), alignof(float));
+        if(alloc.isOk())
+        {
+            memcpy(alloc.pointer, vertices, sizeof(vertices));
+            // ... draw using `ring.getBuffer()` and `alloc.offset`
+        }
+    }
+    ring.endFrame();
+    @endcode
+*/
+class StreamingRingBuffer
+{
+public:
+
+    struct Allocation
+    {
+        void*  pointer; // CPU-side pointer into mapped memory
+        size_t offset;  // Offset from the beginning of buffer (for GPU-side usage)
+        size_t size;
+
+        inline bool isOk() const { return (pointer != nullptr); }
+    };
+
+private:
+
+    Buffer _buffer;
+
+    size_t _region_size;
+    size_t _regions_count;
+
+    size_t _current_region;
+    size_t _head; // Offset inside of current region
+
+    unsigned char* _mapped;
+
+    std::vector<Fence> _fences; // One per region
+
+public:
+
+    StreamingRingBuffer(int target, size_t region_size, size_t regions_count = 3);
+    ~StreamingRingBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Non-copyable & non-moveable, since holds pointer into mapped memory
+    GLWRAP_PREVENT_COPY_ASSIGN_AND_MOVE(StreamingRingBuffer);
+
+    // -------------------------------------------------------------------------
+
+    /// Waits (if needed) until GPU finished reading current region
+    void beginFrame();
+
+    /// Guards current region by fence and switches to next one
+    void endFrame();
+
+    /// 'alignment' may be any (0 is same as 1). Returns not-ok allocation, if
+    /// region has no enough free space.
+    Allocation allocate(size_t size, size_t alignment = 1);
+
+    // -------------------------------------------------------------------------
+
+    Buffer& getBuffer();
+
+    size_t getRegionSize() const;
+    size_t getRegionsCount() const;
+    size_t getCurrentRegion() const;
+
+    /// Offset of current region from the beginning of buffer
+    size_t getRegionOffset() const;
+
+    /// Bytes, allocated in current region
+    size_t getUsedSize() const;
+
+    bool isOk() const;
+};
+
+#endif
+
+} // namespace gl
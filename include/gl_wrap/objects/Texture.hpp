@@ -30,6 +30,9 @@ public:
 
     // -------------------------------------------------------------------------
 
+    // NOTE: glTexImage*() (mutable storage) has no DSA equivalent, so texture
+    //   must be binded for setImage*() even if DSA used (see gl_dsa.hpp)
+
 #if !defined(GLWRAP_GL_GLES) // Not present in OpenGL ES
     void setImage1D(int level,
                     int internalFormat,
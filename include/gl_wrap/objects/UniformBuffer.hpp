@@ -0,0 +1,116 @@
+#pragma once
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstddef>     // for size_t
+#include <type_traits> // for std::is_standard_layout<T>
+
+namespace gl {
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+/**
+    @brief Buffer with GL_UNIFORM_BUFFER target, to feed `layout(std140)`
+      uniform blocks.
+
+    Contains 'slots_count' slots, each padded to
+    GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, so every slot may be binded with
+    glBindBufferRange(). Updating of slot - single glBufferSubData() call,
+    instead of glUniform*() call per member.
+*/
+class UniformBuffer
+{
+    Buffer _buffer;
+
+    size_t _slot_size;   // Unpadded
+    size_t _slot_stride; // Padded to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    size_t _slots_count;
+
+public:
+
+    UniformBuffer(size_t slot_size, size_t slots_count, int usage);
+    virtual ~UniformBuffer();
+
+    // -------------------------------------------------------------------------
+
+    // Moveable
+    GLWRAP_MOVE_DEFAULT(UniformBuffer);
+
+    // Non-copyable
+    GLWRAP_PREVENT_COPY_AND_ASSIGN(UniformBuffer);
+
+    // -------------------------------------------------------------------------
+
+    /// 'size' must be <= getSlotSize()
+    void setSlotRaw(size_t slot, const void* data, size_t size);
+
+    /// Binds slot to uniform buffer binding point 'binding'
+    /// (see ShaderProgram::setUniformBlockBinding())
+    void bindSlot(unsigned int binding, size_t slot = 0);
+
+    // -------------------------------------------------------------------------
+
+    size_t getSlotSize() const;
+    size_t getSlotStride() const;
+    size_t getSlotsCount() const;
+
+    Buffer& getBuffer();
+
+    // -------------------------------------------------------------------------
+
+    static int getOffsetAlignment();
+    static int getMaxBlockSize();
+    static int getMaxBindings();
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Typed gl::UniformBuffer, T - C++ mirror of uniform block
+      (see utils/std140.hpp for layout checks).
+
+    @code{.cpp}
+    // layout(std140) uniform Camera { mat4 view; mat4 projection; };
+    struct Camera
+    {
+        gl::std140::mat4 view;
+        gl::std140::mat4 projection;
+    };
+
+    GLWRAP_STD140_CHECK_FIRST(Camera, view);
+    GLWRAP_STD140_CHECK_NEXT (Camera, view, projection);
+
+    gl::UniformBlock<Camera> camera_ubo(1, GL_DYNAMIC_DRAW);
+    program.setUniformBlockBinding("Camera", 0);
+
+    camera_ubo.update(camera);
+    camera_ubo.bind(0);
+    @endcode
+*/
+template <typename T>
+class UniformBlock : public UniformBuffer
+{
+    static_assert(std::is_standard_layout<T>::value, "Uniform block type must have standard layout");
+
+public:
+
+    UniformBlock(size_t slots_count, int usage)
+        : UniformBuffer(sizeof(T), slots_count, usage)
+    {}
+
+    // -------------------------------------------------------------------------
+
+    inline void update(const T& value, size_t slot = 0) {
+        setSlotRaw(slot, &value, sizeof(T));
+    }
+
+    inline void bind(unsigned int binding, size_t slot = 0) {
+        bindSlot(binding, slot);
+    }
+};
+
+#endif
+
+} // namespace gl
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <gl_wrap/objects/UniformLocationCache.hpp> // for hash_uniform_name()
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
+
+namespace gl {
+
+/**
+    @brief Compile-time hashed & typed uniform identifiers.
+
+    @code{.cpp}
+    static constexpr gl::UniformId<float>           U_TIME("uTime");
+    static constexpr gl::UniformId<gl::glsl::mat4>  U_PROJECTION("uProjection");
+
+    // Once per program (after link)
+    const auto time_handle = program.getUniformHandle(U_TIME);
+
+    // Hot path - exact glUniform1f(), no strings, no branches on type
+    program.setUniform(time_handle, 0.5f);
+
+    // Untyped, still without run-time hashing
+    using namespace gl::literals;
+    program.getUniformLocation("uColor"_uniform);
+    @endcode
+*/
+
+// -----------------------------------------------------------------------------
+// GLSL value types (tightly packed, as expected by glUniform*v())
+
+namespace glsl {
+
+struct vec2  { float x, y; };
+struct vec3  { float x, y, z; };
+struct vec4  { float x, y, z, w; };
+
+struct ivec2 { int32_t x, y; };
+struct ivec3 { int32_t x, y, z; };
+struct ivec4 { int32_t x, y, z, w; };
+
+struct uvec2 { uint32_t x, y; };
+struct uvec3 { uint32_t x, y, z; };
+struct uvec4 { uint32_t x, y, z, w; };
+
+// Column-major
+struct mat2  { float values[4]; };
+struct mat3  { float values[9]; };
+struct mat4  { float values[16]; };
+
+} // namespace glsl
+
+// -----------------------------------------------------------------------------
+
+/// GLSL type of C++ type (GL_FLOAT_VEC3, etc.), not defined - not supported
+template <typename T>
+struct uniform_type_traits;
+
+#define GLWRAP_UNIFORM_TYPE_TRAITS(CPP_TYPE, GL_TYPE) \
+    template <> \
+    struct uniform_type_traits<CPP_TYPE> \
+    { \
+        static constexpr int gl_type = GL_TYPE; \
+    }
+
+GLWRAP_UNIFORM_TYPE_TRAITS(float,        0x1406); // GL_FLOAT
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::vec2,   0x8B50); // GL_FLOAT_VEC2
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::vec3,   0x8B51); // GL_FLOAT_VEC3
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::vec4,   0x8B52); // GL_FLOAT_VEC4
+
+GLWRAP_UNIFORM_TYPE_TRAITS(int,          0x1404); // GL_INT (also samplers)
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::ivec2,  0x8B53); // GL_INT_VEC2
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::ivec3,  0x8B54); // GL_INT_VEC3
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::ivec4,  0x8B55); // GL_INT_VEC4
+
+GLWRAP_UNIFORM_TYPE_TRAITS(unsigned int, 0x1405); // GL_UNSIGNED_INT
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::uvec2,  0x8DC6); // GL_UNSIGNED_INT_VEC2
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::uvec3,  0x8DC7); // GL_UNSIGNED_INT_VEC3
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::uvec4,  0x8DC8); // GL_UNSIGNED_INT_VEC4
+
+GLWRAP_UNIFORM_TYPE_TRAITS(bool,         0x8B56); // GL_BOOL
+
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::mat2,   0x8B5A); // GL_FLOAT_MAT2
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::mat3,   0x8B5B); // GL_FLOAT_MAT3
+GLWRAP_UNIFORM_TYPE_TRAITS(glsl::mat4,   0x8B5C); // GL_FLOAT_MAT4
+
+#undef GLWRAP_UNIFORM_TYPE_TRAITS
+
+// -----------------------------------------------------------------------------
+
+/// Uniform name with hash, computed in compile-time (for constexpr objects)
+struct UniformName
+{
+    const char* name;
+    uint32_t    hash;
+
+    constexpr explicit UniformName(const char* name_)
+        : name(name_)
+        , hash(hash_uniform_name(name_))
+    { }
+};
+
+/// Uniform name with GLSL type
+template <typename T>
+struct UniformId : UniformName
+{
+    using value_type = T;
+
+    constexpr explicit UniformId(const char* name_)
+        : UniformName(name_)
+    { }
+};
+
+/// Location of typed uniform in concrete program (see
+/// ShaderProgram::getUniformHandle())
+template <typename T>
+struct UniformHandle
+{
+    using value_type = T;
+
+    int location;
+
+    constexpr UniformHandle() : location(-1) {}
+    constexpr explicit UniformHandle(int location_) : location(location_) {}
+
+    inline bool isPresent() const { return (location != -1); }
+};
+
+// -----------------------------------------------------------------------------
+
+namespace literals {
+
+/// "uTime"_uniform - untyped name, hashed in compile-time
+constexpr UniformName operator"" _uniform(const char* name, size_t)
+{
+    return UniformName(name);
+}
+
+} // namespace literals
+
+} // namespace gl
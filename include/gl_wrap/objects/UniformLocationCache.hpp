@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint8_t, uint32_t
+#include <string>
+#include <vector>
+
+namespace gl {
+
+/// FNV-1a hash of uniform name, usable in compile-time
+constexpr uint32_t hash_uniform_name(const char* name, uint32_t hash = 2166136261u)
+{
+    return (*name == '\0')
+            ? hash
+            : hash_uniform_name(name + 1, (hash ^ static_cast<uint32_t>(static_cast<uint8_t>(*name))) * 16777619u);
+}
+
+/// Same as hash_uniform_name(), but iterative (for run-time)
+uint32_t hash_uniform_name_runtime(const char* name);
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Uniform name -> location table of single program (open addressing,
+      linear probing, names stored in single string pool).
+
+    Filled by ShaderProgram::link() from glGetActiveUniform(), and lazily on
+    misses, so every name is resolved by GL only once.
+*/
+class UniformLocationCache
+{
+    struct Entry
+    {
+        uint32_t hash;
+        uint32_t name_offset; // In '_names_pool'; UINT32_MAX - empty slot
+        int      location;    // -1 - not present in program
+        bool     is_reported; // Missing uniform already reported
+    };
+
+    std::vector<Entry> _entries; // Size - power of 2
+    std::string        _names_pool;
+    size_t             _count;
+
+public:
+
+    UniformLocationCache();
+
+    // -------------------------------------------------------------------------
+
+    void clear();
+
+    /// Overwrites location, if name already present
+    void insert(const char* name, int location);
+
+    /// Returns false, if name not cached yet
+    bool find(const char* name, int& location) const;
+    bool find(const char* name, uint32_t hash, int& location) const;
+
+    /// Returns true only once per cached name (used to report missing
+    /// uniforms once per program)
+    bool markReported(const char* name);
+
+    // -------------------------------------------------------------------------
+
+    size_t getCount() const;
+
+private:
+
+    size_t findSlot(const char* name, uint32_t hash) const;
+    void   grow();
+};
+
+} // namespace gl
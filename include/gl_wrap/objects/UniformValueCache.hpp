@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief Shadow copy of uniform values of single program, keyed by location.
+
+    Layout is registered from reflected uniform types on link, so every
+    location owns fixed bytes range (array elements share storage of whole
+    array). update() compares incoming packed bytes with shadowed ones and
+    reports, whether GL call may be skipped.
+
+    Values changed bypassing ShaderProgram (raw glUniform*() calls) must be
+    followed by invalidate() / invalidateAll().
+*/
+class UniformValueCache
+{
+    struct Slot
+    {
+        uint32_t offset;        // In '_values'
+        uint32_t capacity;      // Bytes from 'offset' to array end; 0 - not registered
+        uint32_t element_size;
+        uint32_t first_element; // In '_is_known'
+    };
+
+    std::vector<Slot>          _slots; // Indexed by location
+    std::vector<unsigned char> _values;
+    std::vector<unsigned char> _is_known; // Per element: value was set at least once
+
+    size_t _hits_count;
+    size_t _misses_count;
+
+public:
+
+    UniformValueCache();
+
+    // -------------------------------------------------------------------------
+
+    /// Forgets layout & values (counters are kept)
+    void clear();
+
+    /// Registers storage of uniform (of whole array, if 'array_size' > 1)
+    void addUniform(int location, size_t element_size, size_t array_size = 1);
+
+    /// Registers location of array element, sharing storage of array
+    /// registered at 'base_location'
+    void addArrayElement(int location, int base_location, size_t element_index);
+
+    /// Returns true, if values equal to shadowed ones (GL call may be skipped),
+    /// otherwise stores them & returns false
+    bool update(int location, const void* data, size_t size);
+
+    void invalidate(int location);
+    void invalidateAll();
+
+    // -------------------------------------------------------------------------
+
+    /// Hits - calls skipped as redundant, misses - calls passed to GL
+    size_t getHitsCount() const;
+    size_t getMissesCount() const;
+    void resetCounters();
+
+    bool isRegistered(int location) const;
+};
+
+} // namespace gl
@@ -1,11 +1,47 @@
 #pragma once
 
 #include <gl_wrap/objects/Object.hpp>
+#include <gl_wrap/objects/VertexLayout.hpp>
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
+#include <vector>
 
 namespace gl {
 
+class Buffer;
+
+/**
+    @brief Vertex Array Object.
+
+    If VAOs not supported (OpenGL ES 2 without 'GL_OES_vertex_array_object'),
+    they are emulated in software: state, specified by apply() &
+    bindElementBuffer() is recorded on CPU, and on bind() only differing
+    attributes are re-specified. So the same code works on such devices.
+*/
 class VertexArrayObject : public Object
 {
+    // Last applied state (see apply())
+    VertexLayout      _applied_layout;
+    std::vector<id_t> _applied_buffers;
+    uint32_t          _enabled_locations_mask;
+
+    // Last applied state of separate format & buffers binding (see
+    // applyFormat(), bindVertexBuffers())
+    struct BindedVertexBuffer {
+        id_t         id;
+        long         offset;
+        unsigned int stride;
+
+        inline bool operator == (const BindedVertexBuffer& other) const {
+            return (id == other.id) && (offset == other.offset) && (stride == other.stride);
+        }
+    };
+
+    VertexLayout                    _format_layout;
+    bool                            _is_format_applied;
+    std::vector<BindedVertexBuffer> _binded_vertex_buffers;
+
 public:
 
     VertexArrayObject();
@@ -21,15 +57,86 @@ public:
 
     // -------------------------------------------------------------------------
 
+    /// Binding is tracked on CPU: redundant glBindVertexArray() calls skipped
     void bind();
+
+    /// Lazy: only marks binding 0 as wanted, see applyPendingUnbind()
     static void unbind();
 
+    /// Performs pending unbind() (if any). Called automatically by operations,
+    /// which modify current VAO state (see bindElementBuffer())
+    static void applyPendingUnbind();
+
+    /// GL_ELEMENT_ARRAY_BUFFER binding is part of VAO state, so it is done
+    /// here (Buffer::bind() for this target redirects here)
+    static void bindElementBuffer(id_t id);
+
+    /// Forgets tracked binding (next query asks GL). Use after switching GL
+    /// context on same thread, or after binding VAO not via this class.
+    static void invalidateBindingCache();
+
+    // -------------------------------------------------------------------------
+
+    /**
+        Binds VAO & specifies attributes of 'layout', sourced from 'buffers'
+        (indexed by VertexAttribute::buffer_index). Emits only calls, which
+        differ from previously applied state: attributes with unchanged
+        format, stride & buffer are skipped, arrays are enabled/disabled by
+        difference. Binding of GL_ARRAY_BUFFER target is changed.
+
+        NOTE: GL_ELEMENT_ARRAY_BUFFER must be binded separately (after VAO)
+    */
+    void apply(const VertexLayout& layout, Buffer* const* buffers, size_t buffers_count);
+
+    template <size_t SIZE>
+    inline void apply(const VertexLayout& layout, Buffer* const (&buffers)[SIZE]) {
+        apply(layout, buffers, SIZE);
+    }
+
+    inline void apply(const VertexLayout& layout, Buffer& buffer) {
+        Buffer* buffers[] = { &buffer };
+        apply(layout, buffers, 1);
+    }
+
+    // -------------------------------------------------------------------------
+    // Separate attribute format & vertex buffers binding
+
+    /**
+        Specifies only format of attributes (glVertexAttribFormat(),
+        glVertexAttribBinding(), glVertexBindingDivisor()), without buffers -
+        so single VAO per layout can be used with many buffers (and offsets
+        inside of them), swapped by bindVertexBuffers().
+
+        On OpenGL < 4.3 (and OpenGL ES < 3.1) only remembers layout, and
+        bindVertexBuffers() falls back to apply() (pointers path).
+
+        NOTE: do not mix with apply() on same VAO (each overwrites other's
+          state, so everything is re-specified on switch).
+    */
+    void applyFormat(const VertexLayout& layout);
+
+    /// Binds buffer per buffer index of layout, given to applyFormat().
+    /// 'offsets' (in bytes, may be nullptr) - start of vertices in buffers.
+    /// OpenGL 4.4+ - single glBindVertexBuffers() call.
+    void bindVertexBuffers(Buffer* const* buffers, size_t buffers_count, const long* offsets = nullptr);
+
+    template <size_t SIZE>
+    inline void bindVertexBuffers(Buffer* const (&buffers)[SIZE], const long (&offsets)[SIZE]) {
+        bindVertexBuffers(buffers, SIZE, offsets);
+    }
+
+    inline void bindVertexBuffer(Buffer& buffer, long offset = 0) {
+        Buffer* buffers[] = { &buffer };
+        bindVertexBuffers(buffers, 1, &offset);
+    }
+
     // -------------------------------------------------------------------------
 
     bool isOk() const;
 
     // -------------------------------------------------------------------------
 
+    /// Answers from tracker (GL queried only once)
     static id_t getBindedId();
     static void setBindedId(id_t id);
     bool isBinded() const;
@@ -0,0 +1,287 @@
+#pragma once
+
+#include <gl_wrap/utils/gl_ColorRGBA.hpp>
+#include <gl_wrap/utils/gl_Rect.hpp>
+#include <gl_wrap/utils/vertex_packing.hpp> // for VertexAttributeFormat
+
+#include <cstddef> // for size_t, offsetof()
+#include <cstdint> // for int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t
+#include <initializer_list>
+#include <type_traits> // for std::rank<T>, std::extent<T>, std::remove_extent<T>
+#include <vector>
+
+namespace gl {
+
+/// Single vertex attribute, as passed to glVertexAttribPointer() (or to
+/// glVertexAttribIPointer(), if 'is_integer')
+struct VertexAttribute
+{
+    unsigned int location;
+    int          components;
+    int          type;
+    bool         normalized;
+    unsigned int offset;
+    unsigned int buffer_index; // Index in buffers, passed to VertexArrayObject::apply()
+    unsigned int divisor;      // 0 - per vertex, N - per N instances
+    bool         is_integer;   // Read as is by int/ivecN/uintN inputs (integer types only)
+
+    constexpr VertexAttribute(unsigned int location_, int components_, int type_, bool normalized_,
+                              unsigned int offset_, unsigned int buffer_index_ = 0, unsigned int divisor_ = 0,
+                              bool is_integer_ = false)
+        : location(location_)
+        , components(components_)
+        , type(type_)
+        , normalized(normalized_)
+        , offset(offset_)
+        , buffer_index(buffer_index_)
+        , divisor(divisor_)
+        , is_integer(is_integer_)
+    {}
+
+    constexpr bool operator == (const VertexAttribute& other) const
+    {
+        return
+                (location     == other.location)     &&
+                (components   == other.components)   &&
+                (type         == other.type)         &&
+                (normalized   == other.normalized)   &&
+                (offset       == other.offset)       &&
+                (buffer_index == other.buffer_index) &&
+                (divisor      == other.divisor)      &&
+                (is_integer   == other.is_integer);
+    }
+
+    constexpr bool operator != (const VertexAttribute& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Compile-time mapping of C++ member types to attribute formats
+
+/*
+    GL enum values are used as literals here, to not expose GL headers from
+    this header (checked against GL headers in VertexLayout.cpp).
+*/
+template <typename T> struct vertex_component_traits;
+
+template <> struct vertex_component_traits<int8_t>   { static constexpr int type = 0x1400; }; // GL_BYTE
+template <> struct vertex_component_traits<uint8_t>  { static constexpr int type = 0x1401; }; // GL_UNSIGNED_BYTE
+template <> struct vertex_component_traits<int16_t>  { static constexpr int type = 0x1402; }; // GL_SHORT
+template <> struct vertex_component_traits<uint16_t> { static constexpr int type = 0x1403; }; // GL_UNSIGNED_SHORT
+template <> struct vertex_component_traits<int32_t>  { static constexpr int type = 0x1404; }; // GL_INT
+template <> struct vertex_component_traits<uint32_t> { static constexpr int type = 0x1405; }; // GL_UNSIGNED_INT
+template <> struct vertex_component_traits<float>    { static constexpr int type = 0x1406; }; // GL_FLOAT
+
+/// Specialize it for own vector types (glm::vec3, etc)
+template <typename T>
+struct vertex_attribute_traits
+{
+    static constexpr int components = 1;
+    static constexpr int type       = vertex_component_traits<T>::type;
+};
+
+template <typename T, size_t N>
+struct vertex_attribute_traits<T[N]>
+{
+    static_assert((N >= 1) && (N <= 4), "Vertex attribute must have 1..4 components");
+
+    static constexpr int components = static_cast<int>(N);
+    static constexpr int type       = vertex_component_traits<T>::type;
+};
+
+template <>
+struct vertex_attribute_traits<ColorRGBA>
+{
+    static constexpr int components = 4;
+    static constexpr int type       = vertex_component_traits<float>::type;
+};
+
+template <>
+struct vertex_attribute_traits<Rect>
+{
+    static constexpr int components = 4;
+    static constexpr int type       = vertex_component_traits<int32_t>::type;
+};
+
+template <typename Member>
+constexpr VertexAttribute make_vertex_attribute(unsigned int location, size_t offset, bool normalized = false)
+{
+    return VertexAttribute(location,
+                           vertex_attribute_traits<Member>::components,
+                           vertex_attribute_traits<Member>::type,
+                           normalized,
+                           static_cast<unsigned int>(offset));
+}
+
+/// For integer inputs in shader (ivec4, uint, etc), requires OpenGL 3.0 / ES 3.0
+template <typename Member>
+constexpr VertexAttribute make_integer_vertex_attribute(unsigned int location, size_t offset)
+{
+    static_assert(vertex_attribute_traits<Member>::type != vertex_component_traits<float>::type,
+                  "Integer vertex attribute must have integer type");
+
+    return VertexAttribute(location,
+                           vertex_attribute_traits<Member>::components,
+                           vertex_attribute_traits<Member>::type,
+                           false,
+                           static_cast<unsigned int>(offset),
+                           0,
+                           0,
+                           true);
+}
+
+/// Column 'column' of matrix member (`T[COLUMNS][ROWS]`), each column takes
+/// own location
+template <typename Matrix>
+constexpr VertexAttribute make_matrix_column_attribute(unsigned int location, size_t offset, unsigned int column)
+{
+    static_assert(std::rank<Matrix>::value == 2, "Matrix attribute must be 2-dimensional array");
+
+    return VertexAttribute(location + column,
+                           vertex_attribute_traits<typename std::remove_extent<Matrix>::type>::components,
+                           vertex_attribute_traits<typename std::remove_extent<Matrix>::type>::type,
+                           false,
+                           static_cast<unsigned int>(offset + column * sizeof(typename std::remove_extent<Matrix>::type)));
+}
+
+#define GLWRAP_VERTEX_ATTRIBUTE( VERTEX, MEMBER, LOCATION ) \
+    gl::make_vertex_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), false)
+
+#define GLWRAP_VERTEX_ATTRIBUTE_NORMALIZED( VERTEX, MEMBER, LOCATION ) \
+    gl::make_vertex_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), true)
+
+/// Integer member, read by integer input (`ivec4`, etc) - attributes above are
+/// converted to float, so integer types there require `vec4` inputs
+#define GLWRAP_VERTEX_ATTRIBUTE_INTEGER( VERTEX, MEMBER, LOCATION ) \
+    gl::make_integer_vertex_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER))
+
+/// Matrix with 4 columns (`float[4][4]`, etc) - expands into 4 attributes,
+/// at locations LOCATION .. LOCATION + 3
+#define GLWRAP_VERTEX_ATTRIBUTE_MATRIX4( VERTEX, MEMBER, LOCATION )                                  \
+    gl::make_matrix_column_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), 0), \
+    gl::make_matrix_column_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), 1), \
+    gl::make_matrix_column_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), 2), \
+    gl::make_matrix_column_attribute<decltype(VERTEX::MEMBER)>(LOCATION, offsetof(VERTEX, MEMBER), 3)
+
+// -----------------------------------------------------------------------------
+
+/**
+    @brief Description of vertex attributes & buffers strides, applied to
+      VertexArrayObject by VertexArrayObject::apply().
+
+    Layouts are hashed (getHash()), so identical layouts are recognized
+    cheaply.
+
+    @code{.cpp}
+    struct Vertex
+    {
+        float   position[3];
+        uint8_t color[4];
+    };
+
+    static const gl::VertexLayout layout = gl::VertexLayout::fromVertex<Vertex>({
+        GLWRAP_VERTEX_ATTRIBUTE           (Vertex, position, 0),
+        GLWRAP_VERTEX_ATTRIBUTE_NORMALIZED(Vertex, color,    1),
+    });
+
+    vao.apply(layout, vertex_buffer);
+    @endcode
+*/
+class VertexLayout
+{
+    std::vector<VertexAttribute> _attributes;
+    std::vector<unsigned int>    _strides; // Per buffer index
+
+    size_t _hash;
+
+public:
+
+    VertexLayout();
+
+    /// All attributes from single buffer (index 0), stride - sizeof(Vertex)
+    template <typename Vertex>
+    static inline VertexLayout fromVertex(std::initializer_list<VertexAttribute> attributes)
+    {
+        VertexLayout result;
+        result.setStride(0, sizeof(Vertex));
+
+        for(const VertexAttribute& attribute : attributes)
+        {
+            result.add(attribute);
+        }
+
+        return result;
+    }
+
+    /**
+        Adds per-instance attributes of 'Instance' struct, sourced from buffer
+        'buffer_index' (stride - sizeof(Instance)), advancing once per
+        'divisor' instances. 'buffer_index' & 'divisor' of 'attributes' are
+        overridden.
+
+        @code{.cpp}
+        struct Instance
+        {
+            float         transform[4][4];
+            gl::ColorRGBA tint;
+            gl::Rect      sub_rect;
+        };
+
+        layout.addInstanced<Instance>(1, {
+            GLWRAP_VERTEX_ATTRIBUTE_MATRIX4(Instance, transform, 2), // 2..5
+            GLWRAP_VERTEX_ATTRIBUTE        (Instance, tint,      6),
+            GLWRAP_VERTEX_ATTRIBUTE_INTEGER(Instance, sub_rect,  7), // ivec4
+        });
+        @endcode
+    */
+    template <typename Instance>
+    inline VertexLayout& addInstanced(unsigned int buffer_index,
+                                      std::initializer_list<VertexAttribute> attributes,
+                                      unsigned int divisor = 1)
+    {
+        setStride(buffer_index, sizeof(Instance));
+
+        for(VertexAttribute attribute : attributes)
+        {
+            attribute.buffer_index = buffer_index;
+            attribute.divisor      = divisor;
+            add(attribute);
+        }
+
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+
+    VertexLayout& add(const VertexAttribute& attribute);
+
+    VertexLayout& add(unsigned int location, const VertexAttributeFormat& format,
+                      unsigned int offset, unsigned int buffer_index = 0, unsigned int divisor = 0);
+
+    /// Stride of 0 means tightly packed (as for glVertexAttribPointer())
+    VertexLayout& setStride(unsigned int buffer_index, unsigned int stride);
+
+    // -------------------------------------------------------------------------
+
+    const std::vector<VertexAttribute>& getAttributes() const;
+
+    unsigned int getStride(unsigned int buffer_index) const;
+
+    /// Count of buffers, referenced by attributes
+    size_t getBuffersCount() const;
+
+    size_t getHash() const;
+
+    // -------------------------------------------------------------------------
+
+    bool operator == (const VertexLayout& other) const;
+    bool operator != (const VertexLayout& other) const;
+
+private:
+
+    void updateHash();
+};
+
+} // namespace gl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gl_wrap/objects/ShaderProgram.hpp>
+#include <gl_wrap/objects/ProgramBinaryCache.hpp>
 
 namespace gl {
 
@@ -41,5 +42,29 @@ bool make_program_compat(
         const char* vertexShaderSource,
         const char* fragmentShaderSource);
 
+// -----------------------------------------------------------------------------
+// Same, but program is loaded from binary cache, if possible (otherwise it's
+// compiled from sources & stored into cache)
+
+bool make_program_cached(
+        ProgramBinaryCache& cache,
+        const char* name,
+        gl::ShaderProgram& program,
+        const char** vertexShaderSource, int vertexShaderSourceCount,
+        const char** fragmentShaderSource, int fragmentShaderSourceCount);
+
+bool make_program_cached(
+        ProgramBinaryCache& cache,
+        const char* name,
+        gl::ShaderProgram& program,
+        const char* vertexShaderSource,
+        const char* fragmentShaderSource);
+
+bool make_program_compat_cached(
+        ProgramBinaryCache& cache,
+        const char* name,
+        gl::ShaderProgram& program,
+        const char* vertexShaderSource,
+        const char* fragmentShaderSource);
 
 } // namespace gl
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef> // for size_t
+
+namespace gl {
+
+/// True, if [offset, offset + size) fits into 'total_size' bytes. Written as
+/// two comparisons, so (offset + size) can't overflow.
+constexpr bool is_byte_range_inside(size_t offset, size_t size, size_t total_size)
+{
+    return (offset <= total_size) && (size <= total_size - offset);
+}
+
+} // namespace gl
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint16_t, uint32_t
+#include <vector>
+
+namespace gl {
+
+/**
+    @brief CPU-side mesh optimization, to run before uploading of index &
+      vertex data (Buffer::setDataItems()).
+
+    Recommended order:
+      1. optimize_vertex_cache() - triangles reordering for post-transform
+         vertex cache (Tipsify);
+      2. optimize_overdraw() - clusters reordering (outer first), keeping
+         cache efficiency of (1);
+      3. optimize_vertex_fetch_remap() + remap_indices() + remap_vertices() -
+         vertices reordering in order of first use (fetch locality);
+      4. if can_use_16bit_indices() - pack_indices_16bit().
+
+    Or just use optimize_mesh(), which does all of it and reports
+    ACMR/ATVR before & after.
+
+    References:
+      - Sander, Nehab, Barczak: "Fast Triangle Reordering for Vertex Locality
+        and Reduced Overdraw" (2007)
+*/
+
+// -----------------------------------------------------------------------------
+// Analysis
+
+struct VertexCacheStats
+{
+    size_t vertices_transformed;
+
+    /// Average cache miss ratio: transformed vertices per triangle
+    /// (0.5 - best possible, 3.0 - worst)
+    float acmr;
+
+    /// Average transform to vertex ratio: transformed vertices per unique
+    /// vertex (1.0 - best possible)
+    float atvr;
+};
+
+/// Simulates FIFO post-transform vertex cache of 'cache_size' entries
+VertexCacheStats analyze_vertex_cache(const uint32_t* indices, size_t index_count,
+                                      size_t vertex_count, size_t cache_size = 16);
+
+// -----------------------------------------------------------------------------
+// Reordering
+
+/// Tipsify. 'destination' must hold 'index_count' indices, may not alias
+/// 'indices'
+void optimize_vertex_cache(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                           size_t vertex_count, size_t cache_size = 16);
+
+/// Splits already cache-optimized triangles into clusters (at cache
+/// restarts), and sorts clusters to draw outer ones first. 'positions' -
+/// 3 floats per vertex, with 'positions_stride' bytes between vertices.
+/// 'destination' may not alias 'indices'
+void optimize_overdraw(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                       const float* positions, size_t positions_stride,
+                       size_t vertex_count, size_t cache_size = 16);
+
+/// Fills 'remap' ('vertex_count' items) with new vertex index for each old
+/// one, in order of first use. Unused vertices get UINT32_MAX. Returns count
+/// of used vertices.
+size_t optimize_vertex_fetch_remap(uint32_t* remap, const uint32_t* indices, size_t index_count,
+                                   size_t vertex_count);
+
+/// 'destination' may alias 'indices'
+void remap_indices(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                   const uint32_t* remap);
+
+/// 'destination' must hold count of used vertices, may not alias 'vertices'
+void remap_vertices(void* destination, const void* vertices, size_t vertex_count,
+                    size_t vertex_size, const uint32_t* remap);
+
+// -----------------------------------------------------------------------------
+// Indices packing
+
+inline bool can_use_16bit_indices(size_t vertex_count)
+{
+    return (vertex_count <= 65536);
+}
+
+/// Returns GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+int get_optimal_index_type(size_t vertex_count);
+
+/// 'destination' may not alias 'indices'
+void pack_indices_16bit(uint16_t* destination, const uint32_t* indices, size_t index_count);
+
+// -----------------------------------------------------------------------------
+
+struct MeshOptimizationReport
+{
+    VertexCacheStats before;
+    VertexCacheStats after;
+
+    size_t vertex_count;
+    int    index_type; // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+};
+
+/**
+    Whole pipeline (cache, overdraw, fetch) in-place. 'vertices' - interleaved
+    vertices of 'vertex_size' bytes, with 3 floats of position at
+    'position_offset'. Unused vertices are removed.
+
+    Choose index buffer format by `report.index_type`:
+
+    @code{.cpp}
+    auto report = gl::optimize_mesh(indices, vertices, sizeof(Vertex), offsetof(Vertex, position));
+
+    if(report.index_type == GL_UNSIGNED_SHORT)
+    {
+        std::vector<uint16_t> indices_16(indices.size());
+        gl::pack_indices_16bit(indices_16.data(), indices.data(), indices.size());
+        index_buffer.setDataItems(indices_16.size(), indices_16.data(), GL_STATIC_DRAW);
+    }
+    @endcode
+*/
+MeshOptimizationReport optimize_mesh(std::vector<uint32_t>& indices, std::vector<uint8_t>& vertices,
+                                     size_t vertex_size, size_t position_offset,
+                                     size_t cache_size = 16);
+
+} // namespace gl
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef> // for size_t, offsetof()
+#include <cstdint> // for int32_t, uint32_t
+
+namespace gl {
+namespace std140 {
+
+/**
+    @brief C++ types & compile-time checks for `layout(std140)` uniform blocks.
+
+    std140 rules (OpenGL 4.5 spec, section 7.6.2.2) in short:
+
+    | GLSL type            | Base alignment | Size                  |
+    |----------------------|----------------|-----------------------|
+    | float, int, uint     | 4              | 4                     |
+    | bool                 | 4              | 4 (as int32)          |
+    | vec2                 | 8              | 8                     |
+    | vec3                 | 16             | 12                    |
+    | vec4                 | 16             | 16                    |
+    | T[N]                 | 16             | N * round16(size(T))  |
+    | matCxR               | 16             | C columns, as vec4[C] |
+    | struct               | 16             | round16(size)         |
+
+    Note that C++ cannot express 'vec3' exactly (type with alignment 16 and
+    size 12) - std140::vec3 has size 16. So, scalar placed right after vec3
+    (where GLSL packs it at offset 12) is reported by GLWRAP_STD140_CHECK_NEXT
+    - reorder members, or use vec4. Raw C++ arrays (`float w[4]`) are accepted
+    only when their stride already matches std140 one (vec4, mat4, etc) -
+    otherwise use std140::array.
+
+    @code{.cpp}
+    struct Material
+    {
+        gl::std140::vec4              diffuse;
+        gl::std140::vec3              specular;
+        gl::std140::mat4              transform;
+        float                         shininess;
+        gl::std140::array<float, 4>   weights;
+    };
+
+    GLWRAP_STD140_CHECK_FIRST(Material, diffuse);
+    GLWRAP_STD140_CHECK_NEXT (Material, diffuse,   specular);
+    GLWRAP_STD140_CHECK_NEXT (Material, specular,  transform);
+    GLWRAP_STD140_CHECK_NEXT (Material, transform, shininess);
+    GLWRAP_STD140_CHECK_NEXT (Material, shininess, weights);
+    @endcode
+*/
+
+// -----------------------------------------------------------------------------
+// Types
+
+using boolean = int32_t; // GLSL 'bool' takes 4 bytes
+
+struct alignas(8)  vec2  { float x, y; };
+struct alignas(16) vec3  { float x, y, z; };
+struct alignas(16) vec4  { float x, y, z, w; };
+
+struct alignas(8)  ivec2 { int32_t x, y; };
+struct alignas(16) ivec3 { int32_t x, y, z; };
+struct alignas(16) ivec4 { int32_t x, y, z, w; };
+
+struct alignas(8)  uvec2 { uint32_t x, y; };
+struct alignas(16) uvec3 { uint32_t x, y, z; };
+struct alignas(16) uvec4 { uint32_t x, y, z, w; };
+
+// Matrices stored column-major, each column padded to vec4
+struct alignas(16) mat2 { vec4 columns[2]; };
+struct alignas(16) mat3 { vec4 columns[3]; };
+struct alignas(16) mat4 { vec4 columns[4]; };
+
+/// Array element, padded to 16 bytes stride
+template <typename T>
+struct alignas(16) array_element
+{
+    T value;
+};
+
+template <typename T, size_t N>
+struct alignas(16) array
+{
+    array_element<T> elements[N];
+
+    inline T&       operator [] (size_t i)       { return elements[i].value; }
+    inline const T& operator [] (size_t i) const { return elements[i].value; }
+
+    static constexpr size_t size() { return N; }
+};
+
+// -----------------------------------------------------------------------------
+// Traits: std140 base alignment & size of type (not C++ ones)
+
+constexpr size_t round_up(size_t value, size_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+/// Default: nested struct - aligned to 16, size rounded to 16
+template <typename T>
+struct traits
+{
+    static constexpr size_t alignment = 16;
+    static constexpr size_t size      = round_up(sizeof(T), 16);
+};
+
+#define GLWRAP_STD140_TRAITS( TYPE, ALIGNMENT, SIZE )          \
+    template <>                                                \
+    struct traits<TYPE>                                        \
+    {                                                          \
+        static constexpr size_t alignment = ALIGNMENT;         \
+        static constexpr size_t size      = SIZE;              \
+    }
+
+GLWRAP_STD140_TRAITS(float,     4,  4);
+GLWRAP_STD140_TRAITS(int32_t,   4,  4);
+GLWRAP_STD140_TRAITS(uint32_t,  4,  4);
+
+GLWRAP_STD140_TRAITS(vec2,      8,  8);
+GLWRAP_STD140_TRAITS(vec3,     16, 12);
+GLWRAP_STD140_TRAITS(vec4,     16, 16);
+
+GLWRAP_STD140_TRAITS(ivec2,     8,  8);
+GLWRAP_STD140_TRAITS(ivec3,    16, 12);
+GLWRAP_STD140_TRAITS(ivec4,    16, 16);
+
+GLWRAP_STD140_TRAITS(uvec2,     8,  8);
+GLWRAP_STD140_TRAITS(uvec3,    16, 12);
+GLWRAP_STD140_TRAITS(uvec4,    16, 16);
+
+GLWRAP_STD140_TRAITS(mat2,     16, 32);
+GLWRAP_STD140_TRAITS(mat3,     16, 48);
+GLWRAP_STD140_TRAITS(mat4,     16, 64);
+
+#undef GLWRAP_STD140_TRAITS
+
+template <typename T, size_t N>
+struct traits< array<T, N> >
+{
+    static constexpr size_t alignment = 16;
+    static constexpr size_t size      = N * round_up(traits<T>::size, 16);
+};
+
+/// Raw C++ array - elements are not padded, so it matches std140 only when
+/// element size is already multiple of 16
+template <typename T, size_t N>
+struct traits<T[N]>
+{
+    static_assert(sizeof(T) == round_up(traits<T>::size, 16),
+                  "Raw array stride differs from std140 one - use gl::std140::array<T, N>");
+
+    static constexpr size_t alignment = 16;
+    static constexpr size_t size      = N * round_up(traits<T>::size, 16);
+};
+
+// -----------------------------------------------------------------------------
+
+/// Expected std140 offset of member of type `Next`, placed after member of
+/// type `Prev` at 'prev_offset'
+template <typename Prev, typename Next>
+constexpr size_t next_offset(size_t prev_offset)
+{
+    return round_up(prev_offset + traits<Prev>::size, traits<Next>::alignment);
+}
+
+} // namespace std140
+} // namespace gl
+
+// -----------------------------------------------------------------------------
+
+#define GLWRAP_STD140_CHECK_FIRST( STRUCT, MEMBER )                        \
+    static_assert(offsetof(STRUCT, MEMBER) == 0,                           \
+                  #STRUCT "::" #MEMBER " must be first member (offset 0)")
+
+#define GLWRAP_STD140_CHECK_NEXT( STRUCT, PREV_MEMBER, MEMBER )                           \
+    static_assert(offsetof(STRUCT, MEMBER) ==                                             \
+                  gl::std140::next_offset<decltype(STRUCT::PREV_MEMBER),                  \
+                                          decltype(STRUCT::MEMBER)>(                      \
+                                              offsetof(STRUCT, PREV_MEMBER)),             \
+                  #STRUCT "::" #MEMBER " offset not matches std140 layout")
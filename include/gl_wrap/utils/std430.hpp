@@ -0,0 +1,139 @@
+#pragma once
+
+#include <gl_wrap/utils/std140.hpp> // for std140 types, round_up()
+
+#include <cstddef> // for size_t, offsetof()
+
+namespace gl {
+namespace std430 {
+
+/**
+    @brief C++ types & compile-time checks for `layout(std430)` shader
+      storage blocks.
+
+    std430 is std140 without rounding of arrays & structs to 16 bytes:
+
+    | GLSL type            | Base alignment | Size                        |
+    |----------------------|----------------|-----------------------------|
+    | scalars, vecN        | as std140      | as std140                   |
+    | matCxR               | align(vecR)    | C columns, as vecR[C]       |
+    | T[N]                 | align(T)       | N * round(size(T), align(T))|
+    | struct               | max(members)   | round(size, alignment)      |
+
+    Scalar & vector types are shared with gl::std140 (same caveat about
+    'vec3' applies). Matrices are not - their columns are not padded to vec4
+    (mat2 takes 16 bytes, aligned to 8).
+
+    Runtime-sized trailing array (`buffer B { Header h; Item items[]; };`) -
+    mirror the fixed part as C++ struct and check, that array starts right
+    after it (at sizeof(Struct)):
+
+    @code{.cpp}
+    // Aligned as mat4, so array starts right after it
+    struct alignas(16) Instances
+    {
+        gl::std430::uint count;
+        gl::std430::vec2 scale;
+    };
+
+    GLWRAP_STD430_CHECK_FIRST   (Instances, count);
+    GLWRAP_STD430_CHECK_NEXT    (Instances, count, scale);
+    GLWRAP_STD430_CHECK_TRAILING(Instances, scale, gl::std430::mat4);
+    @endcode
+*/
+
+// -----------------------------------------------------------------------------
+// Types
+
+using uint    = uint32_t;
+using boolean = std140::boolean;
+
+using std140::vec2;
+using std140::vec3;
+using std140::vec4;
+
+using std140::ivec2;
+using std140::ivec3;
+using std140::ivec4;
+
+using std140::uvec2;
+using std140::uvec3;
+using std140::uvec4;
+
+// Matrices stored column-major, each column aligned as vecR
+struct alignas(8)  mat2 { vec2 columns[2]; };
+struct alignas(16) mat3 { vec3 columns[3]; };
+struct alignas(16) mat4 { vec4 columns[4]; };
+
+/// Array without padding of elements (unlike std140::array)
+template <typename T, size_t N>
+struct array
+{
+    T elements[N];
+
+    inline T&       operator [] (size_t i)       { return elements[i]; }
+    inline const T& operator [] (size_t i) const { return elements[i]; }
+
+    static constexpr size_t size() { return N; }
+};
+
+// -----------------------------------------------------------------------------
+// Traits: std430 base alignment & size of type (not C++ ones)
+
+using std140::round_up;
+
+/// Default: scalars, vectors, matrices & nested structs - C++ layout of types
+/// above already matches std430
+template <typename T>
+struct traits
+{
+    static constexpr size_t alignment = alignof(T);
+    static constexpr size_t size      = sizeof(T);
+};
+
+// 3-component vectors - the only types, where C++ size differs
+template <> struct traits<vec3>  { static constexpr size_t alignment = 16; static constexpr size_t size = 12; };
+template <> struct traits<ivec3> { static constexpr size_t alignment = 16; static constexpr size_t size = 12; };
+template <> struct traits<uvec3> { static constexpr size_t alignment = 16; static constexpr size_t size = 12; };
+
+template <typename T, size_t N>
+struct traits< array<T, N> >
+{
+    static constexpr size_t alignment = traits<T>::alignment;
+    static constexpr size_t size      = N * round_up(traits<T>::size, traits<T>::alignment);
+};
+
+// -----------------------------------------------------------------------------
+
+/// Expected std430 offset of member of type `Next`, placed after member of
+/// type `Prev` at 'prev_offset'
+template <typename Prev, typename Next>
+constexpr size_t next_offset(size_t prev_offset)
+{
+    return round_up(prev_offset + traits<Prev>::size, traits<Next>::alignment);
+}
+
+} // namespace std430
+} // namespace gl
+
+// -----------------------------------------------------------------------------
+
+#define GLWRAP_STD430_CHECK_FIRST( STRUCT, MEMBER )                        \
+    static_assert(offsetof(STRUCT, MEMBER) == 0,                           \
+                  #STRUCT "::" #MEMBER " must be first member (offset 0)")
+
+#define GLWRAP_STD430_CHECK_NEXT( STRUCT, PREV_MEMBER, MEMBER )                           \
+    static_assert(offsetof(STRUCT, MEMBER) ==                                             \
+                  gl::std430::next_offset<decltype(STRUCT::PREV_MEMBER),                  \
+                                          decltype(STRUCT::MEMBER)>(                      \
+                                              offsetof(STRUCT, PREV_MEMBER)),             \
+                  #STRUCT "::" #MEMBER " offset not matches std430 layout")
+
+/// Checks, that runtime-sized array of ELEMENT_TYPE, following LAST_MEMBER,
+/// starts at sizeof(STRUCT)
+#define GLWRAP_STD430_CHECK_TRAILING( STRUCT, LAST_MEMBER, ELEMENT_TYPE )                 \
+    static_assert(sizeof(STRUCT) ==                                                       \
+                  gl::std430::next_offset<decltype(STRUCT::LAST_MEMBER),                  \
+                                          ELEMENT_TYPE>(                                  \
+                                              offsetof(STRUCT, LAST_MEMBER)),             \
+                  #STRUCT " size not matches offset of trailing " #ELEMENT_TYPE " array")
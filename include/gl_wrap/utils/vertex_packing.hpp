@@ -0,0 +1,83 @@
+#pragma once
+
+#include <gl_wrap/utils/gl_ColorRGBA.hpp>
+
+#include <cstddef> // for size_t
+#include <cstdint> // for int16_t, uint16_t, uint32_t
+
+namespace gl {
+
+/**
+    @brief Packing (quantization) kernels for vertex attribute streams, to
+      reduce vertex memory & upload size (float32 -> 16 or 8 bits per
+      component).
+
+    Kernels are vectorized with SSE2 (+ SSE4.1, F16C when enabled by compiler
+    flags) on x86, NEON on AArch64, with scalar fallback elsewhere. Define
+    `GLWRAP_DISABLE_SIMD` to force scalar code. All variants produce
+    identical results (round to nearest even).
+
+    'count' - count of components (floats), not vertices, unless stated
+    otherwise. Destination may not alias source.
+
+    Packed streams must be described with get_packed_attribute_format(), to
+    bind them correctly (type & normalized flag).
+*/
+
+// -----------------------------------------------------------------------------
+
+/// float -> IEEE 754 half (binary16)
+void pack_half(uint16_t* destination, const float* source, size_t count);
+
+/// [-1, 1] -> [-32767, 32767], input clamped
+void pack_snorm16(int16_t* destination, const float* source, size_t count);
+
+/// [0, 1] -> [0, 65535], input clamped
+void pack_unorm16(uint16_t* destination, const float* source, size_t count);
+
+/**
+    Unit normals (3 floats per normal) -> octahedral encoding, 2 snorm16 per
+    normal. 'count' - count of normals.
+
+    Decoding in GLSL:
+
+    @code{.glsl}
+    vec3 decode_octahedral(vec2 e)
+    {
+        vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+        if(n.z < 0.0)
+            n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+        return normalize(n);
+    }
+    @endcode
+*/
+void pack_octahedral_snorm16(int16_t* destination, const float* normals, size_t count);
+
+/// ColorRGBA -> RGBA8 (byte order R, G, B, A in memory). 'count' - count of
+/// colors.
+void pack_colors_rgba8(uint32_t* destination, const ColorRGBA* colors, size_t count);
+
+// -----------------------------------------------------------------------------
+
+enum class PackedFormat
+{
+    Half,
+    Snorm16,
+    Unorm16,
+    Octahedral16, // Always 2 components
+    RGBA8         // Always 4 components
+};
+
+/// Attribute format, as passed to glVertexAttribPointer()
+struct VertexAttributeFormat
+{
+    int  components;
+    int  type;
+    bool normalized;
+};
+
+/// 'components' - components of source attribute (ignored for
+/// Octahedral16 & RGBA8)
+VertexAttributeFormat get_packed_attribute_format(PackedFormat format, int components);
+
+} // namespace gl
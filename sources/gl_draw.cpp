@@ -0,0 +1,42 @@
+#include <gl_wrap/gl_draw.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+// -----------------------------------------------------------------------------
+
+void gl::Draw::arrays(int mode, int first, int count)
+{
+    GLWRAP_GL_CHECK( glDrawArrays(mode, first, count) );
+}
+
+void gl::Draw::elements(int mode, int count, int type, size_t offset)
+{
+    GLWRAP_GL_CHECK( glDrawElements(mode, count, type, reinterpret_cast<const void*>(offset)) );
+}
+
+// -----------------------------------------------------------------------------
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void gl::Draw::arraysInstanced(int mode, int first, int count, int instance_count)
+{
+    GLWRAP_GL_CHECK( glDrawArraysInstanced(mode, first, count, instance_count) );
+}
+
+void gl::Draw::elementsInstanced(int mode, int count, int type, size_t offset, int instance_count)
+{
+    GLWRAP_GL_CHECK( glDrawElementsInstanced(mode, count, type, reinterpret_cast<const void*>(offset), instance_count) );
+}
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 2)
+void gl::Draw::arraysInstancedBaseInstance(int mode, int first, int count, int instance_count, unsigned int base_instance)
+{
+    GLWRAP_GL_CHECK( glDrawArraysInstancedBaseInstance(mode, first, count, instance_count, base_instance) );
+}
+
+void gl::Draw::elementsInstancedBaseInstance(int mode, int count, int type, size_t offset, int instance_count, unsigned int base_instance)
+{
+    GLWRAP_GL_CHECK( glDrawElementsInstancedBaseInstance(mode, count, type, reinterpret_cast<const void*>(offset), instance_count, base_instance) );
+}
+#endif
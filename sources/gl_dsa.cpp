@@ -0,0 +1,31 @@
+#include <gl_wrap/gl_dsa.hpp>
+
+#include <gl_wrap/gl_extensions.hpp>
+
+static bool DSA_CHECKED   = false;
+static bool DSA_SUPPORTED = false;
+
+bool gl::isDirectStateAccessSupported()
+{
+    // Only once
+    if(DSA_CHECKED == false)
+    {
+        #if !defined(GLWRAP_GL_DSA_AVAILABLE)
+        {
+            DSA_SUPPORTED = false;
+        }
+        #elif GLWRAP_GL_FROM_OPENGL_VER(4, 5)
+        {
+            DSA_SUPPORTED = true;
+        }
+        #else
+        {
+            DSA_SUPPORTED = gl::isExtensionSupported("GL_ARB_direct_state_access");
+        }
+        #endif
+
+        DSA_CHECKED = true;
+    }
+
+    return DSA_SUPPORTED;
+}
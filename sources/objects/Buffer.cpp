@@ -1,7 +1,12 @@
 #include <gl_wrap/objects/Buffer.hpp>
+#include <gl_wrap/objects/NamePool.hpp>
+#include <gl_wrap/objects/VertexArrayObject.hpp>
 
 #include <gl_wrap/gl_context.hpp>
 #include <gl_wrap/gl_error_checking.hpp>
+#include <gl_wrap/gl_dsa.hpp>
+
+#include <utility> // for std::move()
 
 #if defined(GLWRAP_CHECK_BINDED)
     #include <cassert> // for assert()
@@ -14,11 +19,58 @@
 
 // -----------------------------------------------------------------------------
 
+static void gen_buffers(int n, gl::Object::id_t* ids)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        // Unlike glGen*(), glCreate*() creates object itself (not only name),
+        // so it can be edited via DSA functions without binding
+        GLWRAP_GL_CHECK( glCreateBuffers(n, ids) );
+        return;
+    }
+#endif
+
+    GLWRAP_GL_CHECK( glGenBuffers(n, ids) );
+}
+
+static void delete_buffers(int n, const gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( glDeleteBuffers(n, ids) );
+}
+
+template <>
+gl::NamePool& gl::get_name_pool<gl::Buffer>()
+{
+    static NamePool pool(gen_buffers, delete_buffers);
+    return pool;
+}
+
+// -----------------------------------------------------------------------------
+
 gl::Buffer::Buffer(int target)
     : Object()
     , _target(target)
 {
-    GLWRAP_GL_CHECK( glGenBuffers(1, &_id) );
+    _id = get_name_pool<Buffer>().acquire();
+}
+
+gl::Buffer::Buffer(gl::Buffer&& other)
+    : Object(std::move(other))
+    , _target(other._target)
+{ }
+
+gl::Buffer& gl::Buffer::operator = (gl::Buffer&& other)
+{
+    if(this != &other)
+    {
+        GLWRAP_GL_CHECK( glDeleteBuffers(1, &_id) );
+
+        _id       = other._id;
+        _target   = other._target;
+        other._id = 0;
+    }
+    return *this;
 }
 
 gl::Buffer::~Buffer()
@@ -30,18 +82,43 @@ gl::Buffer::~Buffer()
 
 void gl::Buffer::bind()
 {
-    GLWRAP_GL_CHECK( glBindBuffer(_target, _id) );
+    setBindedId(_target, _id);
 }
 
 void gl::Buffer::unbind()
 {
-    GLWRAP_GL_CHECK( glBindBuffer(_target, 0) );
+    setBindedId(_target, 0);
+}
+
+int gl::Buffer::getTarget() const
+{
+    return _target;
+}
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void gl::Buffer::bindBase(unsigned int index)
+{
+    GLWRAP_GL_CHECK( glBindBufferBase(_target, index, _id) );
 }
 
+void gl::Buffer::bindRange(unsigned int index, long offset, size_t size)
+{
+    GLWRAP_GL_CHECK( glBindBufferRange(_target, index, _id, offset, size) );
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 void gl::Buffer::setDataRaw(size_t size, const void* data, int usage)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedBufferData(_id, size, data, usage) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_BUFFER;
 
     GLWRAP_GL_CHECK( glBufferData(_target, size, data, usage) );
@@ -49,6 +126,14 @@ void gl::Buffer::setDataRaw(size_t size, const void* data, int usage)
 
 void gl::Buffer::setSubDataRaw(long offset, size_t size, const void *data)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedBufferSubData(_id, offset, size, data) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_BUFFER;
 
     // TODO: check is offset > 0 && offset < curr_size
@@ -60,6 +145,132 @@ void gl::Buffer::setSubDataRaw(long offset, size_t size, const void *data)
 
 // -----------------------------------------------------------------------------
 
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 4)
+void gl::Buffer::setStorageRaw(size_t size, const void* data, int flags)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedBufferStorage(_id, size, data, flags) );
+        return;
+    }
+#endif
+
+    GLWRAP_CHECK_BINDED_BUFFER;
+
+    GLWRAP_GL_CHECK( glBufferStorage(_target, size, data, flags) );
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void* gl::Buffer::mapRangeRaw(long offset, size_t length, int access)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        void* result = nullptr;
+        GLWRAP_GL_CHECK( result = glMapNamedBufferRange(_id, offset, length, access) );
+        return result;
+    }
+#endif
+
+    GLWRAP_CHECK_BINDED_BUFFER;
+
+    void* result = nullptr;
+    GLWRAP_GL_CHECK( result = glMapBufferRange(_target, offset, length, access) );
+    return result;
+}
+
+bool gl::Buffer::unmap()
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLboolean result;
+        GLWRAP_GL_CHECK( result = glUnmapNamedBuffer(_id) );
+        return (result != GL_FALSE);
+    }
+#endif
+
+    GLWRAP_CHECK_BINDED_BUFFER;
+
+    GLboolean result;
+    GLWRAP_GL_CHECK( result = glUnmapBuffer(_target) );
+    return (result != GL_FALSE);
+}
+
+void gl::Buffer::flushMappedRangeRaw(long offset, size_t length)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glFlushMappedNamedBufferRange(_id, offset, length) );
+        return;
+    }
+#endif
+
+    GLWRAP_CHECK_BINDED_BUFFER;
+
+    GLWRAP_GL_CHECK( glFlushMappedBufferRange(_target, offset, length) );
+}
+
+gl::BufferMapping gl::Buffer::map(long offset, size_t length, int access)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        return BufferMapping(this, offset, length, access);
+    }
+#endif
+
+    GLWRAP_CHECK_BINDED_BUFFER;
+
+    return BufferMapping(this, offset, length, access);
+}
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 2)
+int gl::Buffer::getMinMapBufferAlignment()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_MIN_MAP_BUFFER_ALIGNMENT, &result) );
+    return result;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void gl::Buffer::copySubData(gl::Buffer& source, long source_offset,
+                             gl::Buffer& destination, long destination_offset,
+                             size_t size)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glCopyNamedBufferSubData(source._id, destination._id, source_offset, destination_offset, size) );
+        return;
+    }
+#endif
+
+    setBindedId(GL_COPY_READ_BUFFER,  source._id);
+    setBindedId(GL_COPY_WRITE_BUFFER, destination._id);
+
+    GLWRAP_GL_CHECK( glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, source_offset, destination_offset, size) );
+}
+#endif
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+gl::BufferReadback gl::Buffer::readAsync(long offset, size_t size)
+{
+    return BufferReadback(*this, offset, size);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 #if !defined(GLWRAP_GL_GLES)
 int gl::Buffer::getAccess()
 {
@@ -215,6 +426,14 @@ gl::Buffer::id_t gl::Buffer::getBindedId() const
 
 void gl::Buffer::setBindedId(int target, gl::Object::id_t id)
 {
+    // GL_ELEMENT_ARRAY_BUFFER binding is part of VAO state (lazy unbind,
+    // emulated VAOs)
+    if(target == GL_ELEMENT_ARRAY_BUFFER)
+    {
+        VertexArrayObject::bindElementBuffer(id);
+        return;
+    }
+
     GLWRAP_GL_CHECK( glBindBuffer(target, id) );
 }
 
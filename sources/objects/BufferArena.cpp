@@ -0,0 +1,238 @@
+#include <gl_wrap/objects/BufferArena.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#include <cstdio> // for fprintf(), stderr
+
+static inline size_t align_up(size_t value, size_t alignment)
+{
+    return (value + (alignment - 1)) & ~(alignment - 1);
+}
+
+// -----------------------------------------------------------------------------
+
+gl::BufferArena::BufferArena(int target, int usage, size_t block_size)
+    : _target(target)
+    , _usage(usage)
+    , _block_size(block_size)
+    , _min_alignment( getTargetOffsetAlignment(target) )
+    , _allocated_size(0)
+{ }
+
+gl::BufferArena::~BufferArena()
+{ }
+
+// -----------------------------------------------------------------------------
+
+gl::BufferArena::Allocation gl::BufferArena::allocate(size_t size, size_t alignment)
+{
+    if(size == 0)
+    {
+        return {nullptr, 0, 0, 0};
+    }
+
+    if(alignment < _min_alignment)
+    {
+        alignment = _min_alignment;
+    }
+
+    // Best-fit: smallest free range, that fits 'size' with alignment padding
+    auto it = _free_by_size.lower_bound(size);
+    for(; it != _free_by_size.end(); ++it)
+    {
+        const size_t range_offset = it->second.second;
+        const size_t range_size   = it->first;
+
+        const size_t aligned = align_up(range_offset, alignment);
+        if(aligned + size <= range_offset + range_size)
+        {
+            break;
+        }
+    }
+
+    // No suitable free range - add new block (dedicated, if too big)
+    if(it == _free_by_size.end())
+    {
+        const size_t block_size = (size > _block_size) ? size : _block_size;
+        const size_t block      = addBlock(block_size);
+
+        // New block contains single free range: [0, block_size)
+        auto range = _free_by_size.equal_range(block_size);
+        for(it = range.first; it->second.first != block; ++it) { }
+    }
+
+    const size_t block        = it->second.first;
+    const size_t range_offset = it->second.second;
+    const size_t range_size   = it->first;
+    const size_t aligned      = align_up(range_offset, alignment);
+
+    eraseFreeRange(block, range_offset, range_size);
+
+    // Return padding before & tail after allocation back into free ranges
+    if(aligned > range_offset)
+    {
+        insertFreeRange(block, range_offset, aligned - range_offset);
+    }
+    if(range_offset + range_size > aligned + size)
+    {
+        insertFreeRange(block, aligned + size, (range_offset + range_size) - (aligned + size));
+    }
+
+    _allocated_size += size;
+
+    return {_blocks[block].get(), block, aligned, size};
+}
+
+void gl::BufferArena::free(const gl::BufferArena::Allocation& allocation)
+{
+    if(!allocation.isOk() || (allocation.block >= _blocks.size()))
+    {
+        return;
+    }
+
+    const size_t block = allocation.block;
+    auto& free_ranges = _free_by_offset[block];
+
+    size_t offset = allocation.offset;
+    size_t size   = allocation.size;
+
+    // Coalesce with next free range
+    auto next = free_ranges.lower_bound(offset);
+    if( (next != free_ranges.end()) && (next->first == offset + size) )
+    {
+        const size_t next_size = next->second;
+        eraseFreeRange(block, next->first, next_size);
+        size += next_size;
+    }
+
+    // Coalesce with previous free range
+    auto prev = free_ranges.lower_bound(offset);
+    if(prev != free_ranges.begin())
+    {
+        --prev;
+        if(prev->first + prev->second == offset)
+        {
+            const size_t prev_offset = prev->first;
+            const size_t prev_size   = prev->second;
+            eraseFreeRange(block, prev_offset, prev_size);
+            offset  = prev_offset;
+            size   += prev_size;
+        }
+    }
+
+    insertFreeRange(block, offset, size);
+
+    _allocated_size -= allocation.size;
+}
+
+// -----------------------------------------------------------------------------
+
+int gl::BufferArena::getTarget() const
+{
+    return _target;
+}
+
+int gl::BufferArena::getUsage() const
+{
+    return _usage;
+}
+
+size_t gl::BufferArena::getBlockSize() const
+{
+    return _block_size;
+}
+
+size_t gl::BufferArena::getBlocksCount() const
+{
+    return _blocks.size();
+}
+
+gl::Buffer* gl::BufferArena::getBlock(size_t index) const
+{
+    return _blocks[index].get();
+}
+
+size_t gl::BufferArena::getMinAlignment() const
+{
+    return _min_alignment;
+}
+
+size_t gl::BufferArena::getAllocatedSize() const
+{
+    return _allocated_size;
+}
+
+size_t gl::BufferArena::getFreeSize() const
+{
+    size_t result = 0;
+    for(const auto& item : _free_by_size)
+    {
+        result += item.first;
+    }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::BufferArena::getTargetOffsetAlignment(int target)
+{
+    GLint result = 1;
+
+    switch (target) {
+#if defined(GL_UNIFORM_BUFFER) && defined(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+    case GL_UNIFORM_BUFFER:
+    {
+        GLWRAP_GL_CHECK( glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &result) );
+    } break;
+#endif
+#if defined(GL_SHADER_STORAGE_BUFFER) && defined(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT)
+    case GL_SHADER_STORAGE_BUFFER:
+    {
+        GLWRAP_GL_CHECK( glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &result) );
+    } break;
+#endif
+    default: { } break;
+    }
+
+    return (result > 0) ? static_cast<size_t>(result) : 1;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::BufferArena::addBlock(size_t size)
+{
+    std::unique_ptr<Buffer> buffer(new Buffer(_target));
+    buffer->bind();
+    buffer->setDataRaw(size, nullptr, _usage);
+    buffer->unbind();
+
+    const size_t block = _blocks.size();
+    _blocks.push_back( std::move(buffer) );
+    _free_by_offset.emplace_back();
+
+    insertFreeRange(block, 0, size);
+
+    return block;
+}
+
+void gl::BufferArena::insertFreeRange(size_t block, size_t offset, size_t size)
+{
+    _free_by_offset[block][offset] = size;
+    _free_by_size.insert({size, {block, offset}});
+}
+
+void gl::BufferArena::eraseFreeRange(size_t block, size_t offset, size_t size)
+{
+    _free_by_offset[block].erase(offset);
+
+    auto range = _free_by_size.equal_range(size);
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        if( (it->second.first == block) && (it->second.second == offset) )
+        {
+            _free_by_size.erase(it);
+            break;
+        }
+    }
+}
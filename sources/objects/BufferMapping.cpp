@@ -0,0 +1,216 @@
+#include <gl_wrap/objects/BufferMapping.hpp>
+
+#include <gl_wrap/objects/Buffer.hpp>
+#include <gl_wrap/utils/byte_range.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_dsa.hpp>
+
+#include <algorithm> // for std::sort(), std::min()
+#include <cassert>
+#include <cstdio>    // for fprintf(), stderr
+#include <cstring>   // for memcpy()
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+// Flushing & unmapping (without DSA) works with binded buffer
+static void bind_if_needed(gl::Buffer* buffer)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        return;
+    }
+#endif
+
+    buffer->bind();
+}
+
+// -----------------------------------------------------------------------------
+
+gl::BufferMapping::BufferMapping()
+    : _buffer(nullptr)
+    , _pointer(nullptr)
+    , _offset(0)
+    , _length(0)
+    , _access(0)
+{ }
+
+gl::BufferMapping::BufferMapping(gl::Buffer* buffer, long offset, size_t length, int access)
+    : _buffer(buffer)
+    , _pointer(nullptr)
+    , _offset(offset)
+    , _length(length)
+    , _access(access)
+{
+    _pointer = _buffer->mapRangeRaw(offset, length, access);
+
+    // Failed mapping has nothing to write into, so all writes are rejected
+    if(_pointer == nullptr)
+    {
+        _length = 0;
+    }
+}
+
+gl::BufferMapping::~BufferMapping()
+{
+    unmap();
+}
+
+// -----------------------------------------------------------------------------
+
+gl::BufferMapping::BufferMapping(gl::BufferMapping&& other)
+    : _buffer(other._buffer)
+    , _pointer(other._pointer)
+    , _offset(other._offset)
+    , _length(other._length)
+    , _access(other._access)
+    , _dirty_ranges(std::move(other._dirty_ranges))
+{
+    other._buffer  = nullptr;
+    other._pointer = nullptr;
+}
+
+gl::BufferMapping& gl::BufferMapping::operator = (gl::BufferMapping&& other)
+{
+    if(this != &other)
+    {
+        unmap();
+
+        _buffer       = other._buffer;
+        _pointer      = other._pointer;
+        _offset       = other._offset;
+        _length       = other._length;
+        _access       = other._access;
+        _dirty_ranges = std::move(other._dirty_ranges);
+
+        other._buffer  = nullptr;
+        other._pointer = nullptr;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::BufferMapping::markDirty(size_t offset, size_t length)
+{
+    // Ranges are clamped to the mapping, so flush() never goes outside of it
+    if(offset >= _length)
+    {
+        return;
+    }
+
+    length = std::min(length, _length - offset);
+
+    if(length > 0)
+    {
+        _dirty_ranges.push_back({offset, length});
+    }
+}
+
+void gl::BufferMapping::write(size_t offset, const void* data, size_t length)
+{
+    if(!is_byte_range_inside(offset, length, _length))
+    {
+        fprintf(stderr, "[GLWRAP] BufferMapping: cannot write %zu bytes at offset %zu into mapping of %zu bytes!\n", length, offset, _length);
+        fflush(stderr);
+
+        assert(false);
+        return;
+    }
+
+    if(length == 0)
+    {
+        return;
+    }
+
+    memcpy(static_cast<unsigned char*>(_pointer) + offset, data, length);
+    markDirty(offset, length);
+}
+
+void gl::BufferMapping::flush()
+{
+    if( (_pointer == nullptr) || ((_access & GL_MAP_FLUSH_EXPLICIT_BIT) == 0) || _dirty_ranges.empty() )
+    {
+        _dirty_ranges.clear();
+        return;
+    }
+
+    // Merge overlapping & adjacent ranges, so each byte flushed only once
+    // with minimal count of glFlushMappedBufferRange() calls
+    std::sort(_dirty_ranges.begin(), _dirty_ranges.end(),
+              [](const Range& a, const Range& b) { return a.offset < b.offset; });
+
+    bind_if_needed(_buffer);
+
+    Range current = _dirty_ranges.front();
+    for(size_t i = 1; i < _dirty_ranges.size(); ++i)
+    {
+        const Range& next = _dirty_ranges[i];
+        if(next.offset <= current.offset + current.length)
+        {
+            const size_t end = std::max(current.offset + current.length, next.offset + next.length);
+            current.length = end - current.offset;
+        }
+        else
+        {
+            _buffer->flushMappedRangeRaw(current.offset, current.length);
+            current = next;
+        }
+    }
+    _buffer->flushMappedRangeRaw(current.offset, current.length);
+
+    _dirty_ranges.clear();
+}
+
+bool gl::BufferMapping::unmap()
+{
+    if(_pointer == nullptr)
+    {
+        return true;
+    }
+
+    flush();
+
+    bind_if_needed(_buffer);
+    const bool result = _buffer->unmap();
+
+    _buffer  = nullptr;
+    _pointer = nullptr;
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+void* gl::BufferMapping::getPointer() const
+{
+    return _pointer;
+}
+
+long gl::BufferMapping::getOffset() const
+{
+    return _offset;
+}
+
+size_t gl::BufferMapping::getLength() const
+{
+    return _length;
+}
+
+int gl::BufferMapping::getAccess() const
+{
+    return _access;
+}
+
+const std::vector<gl::BufferMapping::Range>& gl::BufferMapping::getDirtyRanges() const
+{
+    return _dirty_ranges;
+}
+
+bool gl::BufferMapping::isOk() const
+{
+    return (_pointer != nullptr);
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include <gl_wrap/objects/BufferPool.hpp>
+
+#include <cstdint> // for SIZE_MAX
+
+gl::BufferPool::BufferPool(size_t max_idle_frames, size_t min_size_class)
+    : _max_idle_frames(max_idle_frames)
+    , _min_size_class( (min_size_class > 0) ? min_size_class : 1 ) // 0 can't grow by shift
+    , _frame(0)
+    , _stats{0, 0, 0}
+{ }
+
+gl::BufferPool::~BufferPool()
+{ }
+
+// -----------------------------------------------------------------------------
+
+gl::BufferPool::Entry gl::BufferPool::acquire(int target, int usage, size_t size)
+{
+    const size_t capacity = getSizeClass(size);
+
+    auto found = _idle.find( key_t(target, usage, capacity) );
+    if( (found != _idle.end()) && !found->second.empty() )
+    {
+        // Take most recently released one (LIFO), so rarely-needed buffers
+        // stay in front and expire in nextFrame()
+        std::unique_ptr<Buffer> buffer = std::move(found->second.back().buffer);
+        found->second.pop_back();
+
+        ++_stats.hits;
+        return {std::move(buffer), usage, capacity};
+    }
+
+    std::unique_ptr<Buffer> buffer(new Buffer(target));
+    buffer->bind();
+    buffer->setDataRaw(capacity, nullptr, usage);
+    buffer->unbind();
+
+    ++_stats.misses;
+    return {std::move(buffer), usage, capacity};
+}
+
+void gl::BufferPool::release(gl::BufferPool::Entry&& entry)
+{
+    if(!entry.isOk())
+    {
+        return;
+    }
+
+    const key_t key(entry.buffer->getTarget(), entry.usage, entry.capacity);
+    _idle[key].push_back({std::move(entry.buffer), _frame});
+}
+
+void gl::BufferPool::nextFrame()
+{
+    ++_frame;
+
+    for(auto& item : _idle)
+    {
+        auto& buffers = item.second;
+
+        // Buffers pushed in order of release, so oldest ones are in front
+        size_t expired = 0;
+        while( (expired < buffers.size()) && (_frame - buffers[expired].released_frame > _max_idle_frames) )
+        {
+            ++expired;
+        }
+
+        if(expired > 0)
+        {
+            buffers.erase(buffers.begin(), buffers.begin() + expired);
+            _stats.evictions += expired;
+        }
+    }
+}
+
+void gl::BufferPool::clear()
+{
+    for(const auto& item : _idle)
+    {
+        _stats.evictions += item.second.size();
+    }
+    _idle.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::BufferPool::getSizeClass(size_t size) const
+{
+    size_t result = _min_size_class;
+    while(result < size)
+    {
+        // Next class doesn't fit in size_t - use exact size
+        if(result > (SIZE_MAX >> 1))
+        {
+            return size;
+        }
+        result <<= 1;
+    }
+    return result;
+}
+
+size_t gl::BufferPool::getIdleCount() const
+{
+    size_t result = 0;
+    for(const auto& item : _idle)
+    {
+        result += item.second.size();
+    }
+    return result;
+}
+
+const gl::BufferPool::Stats& gl::BufferPool::getStats() const
+{
+    return _stats;
+}
+
+void gl::BufferPool::resetStats()
+{
+    _stats = {0, 0, 0};
+}
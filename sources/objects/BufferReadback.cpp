@@ -0,0 +1,87 @@
+#include <gl_wrap/objects/BufferReadback.hpp>
+
+#include <gl_wrap/objects/Buffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+#include <cstring> // for memcpy()
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+gl::BufferReadback::BufferReadback()
+    : _staging()
+    , _fence()
+    , _size(0)
+{ }
+
+gl::BufferReadback::BufferReadback(gl::Buffer& source, long offset, size_t size)
+    : _staging(new Buffer(GL_COPY_WRITE_BUFFER))
+    , _fence()
+    , _size(size)
+{
+    _staging->bind();
+    _staging->setDataRaw(_size, nullptr, GL_STREAM_READ);
+
+    Buffer::copySubData(source, offset, *_staging, 0, _size);
+
+    _fence.insert();
+}
+
+gl::BufferReadback::~BufferReadback()
+{ }
+
+// -----------------------------------------------------------------------------
+
+gl::BufferReadback::BufferReadback(gl::BufferReadback&& other) = default;
+
+gl::BufferReadback& gl::BufferReadback::operator = (gl::BufferReadback&& other) = default;
+
+// -----------------------------------------------------------------------------
+
+bool gl::BufferReadback::isReady() const
+{
+    return isOk() && _fence.isSignaled();
+}
+
+bool gl::BufferReadback::wait()
+{
+    return isOk() && _fence.wait();
+}
+
+bool gl::BufferReadback::tryRead(void* destination)
+{
+    if(!isReady())
+    {
+        return false;
+    }
+
+    _staging->bind();
+
+    BufferMapping mapping = _staging->map(0, _size, GL_MAP_READ_BIT);
+    if(!mapping.isOk())
+    {
+        return false;
+    }
+
+    memcpy(destination, mapping.getPointer(), _size);
+    return mapping.unmap();
+}
+
+bool gl::BufferReadback::read(void* destination)
+{
+    return wait() && tryRead(destination);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::BufferReadback::getSize() const
+{
+    return _size;
+}
+
+bool gl::BufferReadback::isOk() const
+{
+    return (_staging != nullptr);
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include <gl_wrap/objects/DrawIndirectBuffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 0) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+
+// Make sure, that command structs have exactly layout, defined by GL
+static_assert(sizeof(gl::DrawArraysIndirectCommand)   == 4 * sizeof(uint32_t), "Test failed");
+static_assert(sizeof(gl::DrawElementsIndirectCommand) == 5 * sizeof(uint32_t), "Test failed");
+
+gl::DrawIndirectBuffer::DrawIndirectBuffer(int usage)
+    : _buffer(GL_DRAW_INDIRECT_BUFFER)
+    , _usage(usage)
+    , _capacity(0)
+    , _uploaded_elements_count(0)
+    , _uploaded_arrays_count(0)
+{ }
+
+gl::DrawIndirectBuffer::~DrawIndirectBuffer()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::DrawIndirectBuffer::addElements(uint32_t count, uint32_t instance_count,
+                                         uint32_t first_index, int32_t base_vertex,
+                                         uint32_t base_instance)
+{
+    DrawElementsIndirectCommand command;
+    command.count          = count;
+    command.instance_count = instance_count;
+    command.first_index    = first_index;
+    command.base_vertex    = base_vertex;
+    command.base_instance  = base_instance;
+
+    _elements_commands.push_back(command);
+}
+
+void gl::DrawIndirectBuffer::addElements(const gl::DrawElementsIndirectCommand& command)
+{
+    _elements_commands.push_back(command);
+}
+
+void gl::DrawIndirectBuffer::addArrays(uint32_t count, uint32_t instance_count,
+                                       uint32_t first, uint32_t base_instance)
+{
+    DrawArraysIndirectCommand command;
+    command.count          = count;
+    command.instance_count = instance_count;
+    command.first          = first;
+    command.base_instance  = base_instance;
+
+    _arrays_commands.push_back(command);
+}
+
+void gl::DrawIndirectBuffer::addArrays(const gl::DrawArraysIndirectCommand& command)
+{
+    _arrays_commands.push_back(command);
+}
+
+void gl::DrawIndirectBuffer::clear()
+{
+    _elements_commands.clear();
+    _arrays_commands.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::DrawIndirectBuffer::upload()
+{
+    const size_t elements_size = _elements_commands.size() * sizeof(DrawElementsIndirectCommand);
+    const size_t arrays_size   = _arrays_commands.size()   * sizeof(DrawArraysIndirectCommand);
+    const size_t total_size    = elements_size + arrays_size;
+
+    _buffer.bind();
+
+    if(total_size > _capacity)
+    {
+        _buffer.setDataRaw(total_size, nullptr, _usage);
+        _capacity = total_size;
+    }
+
+    if(elements_size > 0)
+    {
+        _buffer.setSubDataRaw(0, elements_size, _elements_commands.data());
+    }
+
+    if(arrays_size > 0)
+    {
+        _buffer.setSubDataRaw(elements_size, arrays_size, _arrays_commands.data());
+    }
+
+    _uploaded_elements_count = _elements_commands.size();
+    _uploaded_arrays_count   = _arrays_commands.size();
+}
+
+void gl::DrawIndirectBuffer::drawElements(int mode, int type)
+{
+    if(_uploaded_elements_count == 0)
+    {
+        return;
+    }
+
+    _buffer.bind();
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 3)
+    GLWRAP_GL_CHECK( glMultiDrawElementsIndirect(mode, type, nullptr, static_cast<GLsizei>(_uploaded_elements_count), 0) );
+#else
+    for(size_t i = 0; i < _uploaded_elements_count; ++i)
+    {
+        const size_t offset = i * sizeof(DrawElementsIndirectCommand);
+        GLWRAP_GL_CHECK( glDrawElementsIndirect(mode, type, reinterpret_cast<const void*>(offset)) );
+    }
+#endif
+}
+
+void gl::DrawIndirectBuffer::drawArrays(int mode)
+{
+    if(_uploaded_arrays_count == 0)
+    {
+        return;
+    }
+
+    _buffer.bind();
+
+    // Arrays commands are placed right after elements commands
+    const size_t base_offset = _uploaded_elements_count * sizeof(DrawElementsIndirectCommand);
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 3)
+    GLWRAP_GL_CHECK( glMultiDrawArraysIndirect(mode, reinterpret_cast<const void*>(base_offset), static_cast<GLsizei>(_uploaded_arrays_count), 0) );
+#else
+    for(size_t i = 0; i < _uploaded_arrays_count; ++i)
+    {
+        const size_t offset = base_offset + i * sizeof(DrawArraysIndirectCommand);
+        GLWRAP_GL_CHECK( glDrawArraysIndirect(mode, reinterpret_cast<const void*>(offset)) );
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::DrawIndirectBuffer::getElementsCommandsCount() const
+{
+    return _elements_commands.size();
+}
+
+size_t gl::DrawIndirectBuffer::getArraysCommandsCount() const
+{
+    return _arrays_commands.size();
+}
+
+gl::Buffer& gl::DrawIndirectBuffer::getBuffer()
+{
+    return _buffer;
+}
+
+#endif
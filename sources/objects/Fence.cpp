@@ -0,0 +1,122 @@
+#include <gl_wrap/objects/Fence.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+// Timeout of single glClientWaitSync() call inside of gl::Fence::wait()
+static constexpr uint64_t WAIT_TIMEOUT_NS = 1000000; // 1 ms
+
+// -----------------------------------------------------------------------------
+
+gl::Fence::Fence()
+    : _handle(nullptr)
+{ }
+
+gl::Fence::~Fence()
+{
+    reset();
+}
+
+// -----------------------------------------------------------------------------
+
+gl::Fence::Fence(gl::Fence&& other)
+    : _handle(other._handle)
+{
+    other._handle = nullptr;
+}
+
+gl::Fence& gl::Fence::operator = (gl::Fence&& other)
+{
+    if(this != &other)
+    {
+        reset();
+
+        _handle = other._handle;
+        other._handle = nullptr;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::Fence::insert()
+{
+    reset();
+
+    GLsync sync = nullptr;
+    GLWRAP_GL_CHECK( sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) );
+    _handle = sync;
+}
+
+void gl::Fence::reset()
+{
+    if(_handle != nullptr)
+    {
+        GLWRAP_GL_CHECK( glDeleteSync( static_cast<GLsync>(_handle) ) );
+        _handle = nullptr;
+    }
+}
+
+bool gl::Fence::isInserted() const
+{
+    return (_handle != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+
+bool gl::Fence::isSignaled() const
+{
+    if(_handle == nullptr)
+    {
+        return true;
+    }
+
+    GLint status = GL_UNSIGNALED;
+    GLWRAP_GL_CHECK( glGetSynciv( static_cast<GLsync>(_handle), GL_SYNC_STATUS, 1, nullptr, &status) );
+    return (status == GL_SIGNALED);
+}
+
+int gl::Fence::clientWait(uint64_t timeout_ns)
+{
+    if(_handle == nullptr)
+    {
+        return GL_ALREADY_SIGNALED;
+    }
+
+    GLenum result;
+    GLWRAP_GL_CHECK( result = glClientWaitSync( static_cast<GLsync>(_handle), GL_SYNC_FLUSH_COMMANDS_BIT, timeout_ns) );
+    return result;
+}
+
+bool gl::Fence::wait()
+{
+    while(true)
+    {
+        switch( clientWait(WAIT_TIMEOUT_NS) )
+        {
+        case GL_ALREADY_SIGNALED:
+        case GL_CONDITION_SATISFIED: return true;
+        case GL_TIMEOUT_EXPIRED:     continue;
+        default:                     return false; // GL_WAIT_FAILED
+        }
+    }
+}
+
+void gl::Fence::serverWait()
+{
+    if(_handle != nullptr)
+    {
+        GLWRAP_GL_CHECK( glWaitSync( static_cast<GLsync>(_handle), 0, GL_TIMEOUT_IGNORED) );
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+gl::Fence::handle_t gl::Fence::getHandle() const
+{
+    return _handle;
+}
+
+#endif
@@ -1,7 +1,9 @@
 #include <gl_wrap/objects/FrameBuffer.hpp>
+#include <gl_wrap/objects/NamePool.hpp>
 
 #include <gl_wrap/gl_context.hpp>
 #include <gl_wrap/gl_error_checking.hpp>
+#include <gl_wrap/gl_dsa.hpp>
 
 #if defined(GLWRAP_CHECK_BINDED)
     #include <cassert> // for assert()
@@ -14,11 +16,38 @@
 
 // -----------------------------------------------------------------------------
 
+static void gen_framebuffers(int n, gl::Object::id_t* ids)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glCreateFramebuffers(n, ids) );
+        return;
+    }
+#endif
+
+    GLWRAP_GL_CHECK( glGenFramebuffers(n, ids) );
+}
+
+static void delete_framebuffers(int n, const gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( glDeleteFramebuffers(n, ids) );
+}
+
+template <>
+gl::NamePool& gl::get_name_pool<gl::FrameBuffer>()
+{
+    static NamePool pool(gen_framebuffers, delete_framebuffers);
+    return pool;
+}
+
+// -----------------------------------------------------------------------------
+
 gl::FrameBuffer::FrameBuffer(int target)
     : Object()
     , _target(target)
 {
-    GLWRAP_GL_CHECK( glGenFramebuffers(1, &_id) );
+    _id = get_name_pool<FrameBuffer>().acquire();
 }
 
 gl::FrameBuffer::~FrameBuffer()
@@ -42,6 +71,15 @@ void gl::FrameBuffer::unbind()
 
 int gl::FrameBuffer::checkStatus()
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLenum status;
+        GLWRAP_GL_CHECK( status = glCheckNamedFramebufferStatus(_id, _target) );
+        return status;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLenum status;
@@ -53,6 +91,14 @@ int gl::FrameBuffer::checkStatus()
 
 void gl::FrameBuffer::attachRenderBuffer(int attachment, gl::Object::id_t renderbuffer_id)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedFramebufferRenderbuffer(_id, attachment, GL_RENDERBUFFER, renderbuffer_id) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLWRAP_GL_CHECK( glFramebufferRenderbuffer(_target, attachment, GL_RENDERBUFFER, renderbuffer_id) );
@@ -60,6 +106,14 @@ void gl::FrameBuffer::attachRenderBuffer(int attachment, gl::Object::id_t render
 
 void gl::FrameBuffer::attachRenderBuffer(int attachment, gl::RenderBuffer *renderbuffer)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedFramebufferRenderbuffer(_id, attachment, GL_RENDERBUFFER, renderbuffer->getId()) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLWRAP_GL_CHECK( glFramebufferRenderbuffer(_target, attachment, GL_RENDERBUFFER, renderbuffer->getId()) );
@@ -68,6 +122,23 @@ void gl::FrameBuffer::attachRenderBuffer(int attachment, gl::RenderBuffer *rende
 #if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(2, 0))
 void gl::FrameBuffer::attachTexture2D(int attachment, int texTarget, id_t texture_id, int level)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        // Texture target is implied by texture itself, except cube map faces,
+        // which are attached as layers
+        if( (texTarget >= GL_TEXTURE_CUBE_MAP_POSITIVE_X) && (texTarget <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) )
+        {
+            GLWRAP_GL_CHECK( glNamedFramebufferTextureLayer(_id, attachment, texture_id, level, texTarget - GL_TEXTURE_CUBE_MAP_POSITIVE_X) );
+        }
+        else
+        {
+            GLWRAP_GL_CHECK( glNamedFramebufferTexture(_id, attachment, texture_id, level) );
+        }
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLWRAP_GL_CHECK( glFramebufferTexture2D(_target, attachment, texTarget, texture_id, level) );
@@ -77,6 +148,14 @@ void gl::FrameBuffer::attachTexture2D(int attachment, int texTarget, id_t textur
 #if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
 void gl::FrameBuffer::attachTextureLayer(int attachment, gl::Object::id_t texture_id, int level, int layer)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedFramebufferTextureLayer(_id, attachment, texture_id, level, layer) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLWRAP_GL_CHECK( glFramebufferTextureLayer(_target, attachment, texture_id, level, layer) );
@@ -86,6 +165,14 @@ void gl::FrameBuffer::attachTextureLayer(int attachment, gl::Object::id_t textur
 #if (GLWRAP_GL_FROM_OPENGL_VER(3, 2) || GLWRAP_GL_FROM_GLES_VER(3, 2))
 void gl::FrameBuffer::attachTexture(int attachment, id_t texture_id, int level)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedFramebufferTexture(_id, attachment, texture_id, level) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_FRAMEBUFFER;
 
     GLWRAP_GL_CHECK( glFramebufferTexture(_target, attachment, texture_id, level) );
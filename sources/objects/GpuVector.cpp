@@ -0,0 +1,119 @@
+#include <gl_wrap/objects/GpuVector.hpp>
+
+#include <gl_wrap/utils/byte_range.hpp>
+
+#include <cassert>
+#include <cstdio> // for fprintf(), stderr
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+gl::GpuVectorBase::GpuVectorBase(int target, int usage, size_t initial_capacity)
+    : _target(target)
+    , _usage(usage)
+    , _buffer(new Buffer(target))
+    , _size(0)
+    , _capacity(0)
+    , _reallocations_count(0)
+{
+    _buffer->bind();
+    _buffer->setDataRaw(initial_capacity, nullptr, _usage);
+    _capacity = initial_capacity;
+}
+
+gl::GpuVectorBase::~GpuVectorBase()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::GpuVectorBase::reserveBytes(size_t capacity)
+{
+    if(capacity <= _capacity)
+    {
+        return;
+    }
+
+    std::unique_ptr<Buffer> new_buffer(new Buffer(_target));
+    new_buffer->bind();
+    new_buffer->setDataRaw(capacity, nullptr, _usage);
+
+    // Copy old content GPU-side
+    if(_size > 0)
+    {
+        Buffer::copySubData(*_buffer, 0, *new_buffer, 0, _size);
+    }
+
+    _buffer   = std::move(new_buffer);
+    _capacity = capacity;
+
+    ++_reallocations_count;
+}
+
+void gl::GpuVectorBase::appendBytes(const void* data, size_t size)
+{
+    if(_size + size > _capacity)
+    {
+        const size_t doubled = _capacity * 2;
+        reserveBytes( (doubled > _size + size) ? doubled : (_size + size) );
+    }
+
+    _buffer->bind();
+    _buffer->setSubDataRaw(_size, size, data);
+
+    _size += size;
+}
+
+void gl::GpuVectorBase::setBytes(size_t offset, const void* data, size_t size)
+{
+    if(!is_byte_range_inside(offset, size, _size))
+    {
+        fprintf(stderr, "[GLWRAP] GpuVector: cannot set %zu bytes at offset %zu, size is %zu bytes!\n", size, offset, _size);
+        fflush(stderr);
+
+        assert(false);
+        return;
+    }
+
+    _buffer->bind();
+    _buffer->setSubDataRaw(offset, size, data);
+}
+
+void gl::GpuVectorBase::resizeBytes(size_t size)
+{
+    if(size > _capacity)
+    {
+        const size_t doubled = _capacity * 2;
+        reserveBytes( (doubled > size) ? doubled : size );
+    }
+
+    // NOTE: new bytes (if grown) are not initialized
+    _size = size;
+}
+
+void gl::GpuVectorBase::clear()
+{
+    _size = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::GpuVectorBase::getSizeBytes() const
+{
+    return _size;
+}
+
+size_t gl::GpuVectorBase::getCapacityBytes() const
+{
+    return _capacity;
+}
+
+size_t gl::GpuVectorBase::getReallocationsCount() const
+{
+    return _reallocations_count;
+}
+
+gl::Buffer& gl::GpuVectorBase::getBuffer()
+{
+    return *_buffer;
+}
+
+#endif
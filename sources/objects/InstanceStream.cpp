@@ -0,0 +1,101 @@
+#include <gl_wrap/objects/InstanceStream.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_draw.hpp>
+
+#include <cstring> // for memcpy()
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 3) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+gl::InstanceStreamBase::InstanceStreamBase(size_t instance_size, int usage)
+    : _stream(GL_ARRAY_BUFFER, 0, usage)
+    , _instance_size(instance_size)
+    , _uploaded_count(0)
+{ }
+
+gl::InstanceStreamBase::~InstanceStreamBase()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::InstanceStreamBase::clear()
+{
+    _staging.clear();
+}
+
+void gl::InstanceStreamBase::pushRaw(const void* instances, size_t count)
+{
+    const size_t old_size = _staging.size();
+
+    _staging.resize(old_size + count * _instance_size);
+    memcpy(_staging.data() + old_size, instances, count * _instance_size);
+}
+
+void gl::InstanceStreamBase::upload()
+{
+    const size_t size = _staging.size();
+
+    _uploaded_count = 0;
+
+    if(size == 0)
+    {
+        return;
+    }
+
+    // VAO sources instances from the beginning of buffer, so each set is
+    // written at offset 0 of fresh (orphaned) storage
+    if(size > _stream.getSize())
+    {
+        _stream.resize(size);
+    }
+    else
+    {
+        _stream.orphan();
+    }
+
+    if(_stream.append(_staging.data(), size) == 0)
+    {
+        _uploaded_count = size / _instance_size;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::InstanceStreamBase::drawArrays(int mode, int first, int count)
+{
+    if(_uploaded_count == 0)
+    {
+        return;
+    }
+
+    Draw::arraysInstanced(mode, first, count, static_cast<int>(_uploaded_count));
+}
+
+void gl::InstanceStreamBase::drawElements(int mode, int count, int type, size_t offset)
+{
+    if(_uploaded_count == 0)
+    {
+        return;
+    }
+
+    Draw::elementsInstanced(mode, count, type, offset, static_cast<int>(_uploaded_count));
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::InstanceStreamBase::getStagedCount() const
+{
+    return _staging.size() / _instance_size;
+}
+
+size_t gl::InstanceStreamBase::getUploadedCount() const
+{
+    return _uploaded_count;
+}
+
+gl::Buffer& gl::InstanceStreamBase::getBuffer()
+{
+    return _stream.getBuffer();
+}
+
+#endif
@@ -0,0 +1,107 @@
+#include <gl_wrap/objects/NamePool.hpp>
+
+gl::NamePool::NamePool(gen_func_t gen_func, delete_func_t delete_func, size_t block_size)
+    : _gen_func(gen_func)
+    , _delete_func(delete_func)
+    , _block_size(block_size)
+    , _enabled(false)
+    , _gen_calls_count(0)
+{ }
+
+gl::NamePool::~NamePool()
+{ }
+
+// -----------------------------------------------------------------------------
+
+gl::NamePool::id_t gl::NamePool::acquire()
+{
+    if(_names.empty())
+    {
+        generate(_enabled ? _block_size : 1);
+    }
+
+    const id_t id = _names.back();
+    _names.pop_back();
+    return id;
+}
+
+void gl::NamePool::reserve(size_t count)
+{
+    if(_names.size() < count)
+    {
+        generate(count - _names.size());
+    }
+}
+
+void gl::NamePool::clear()
+{
+    if(!_names.empty())
+    {
+        _delete_func(static_cast<int>(_names.size()), _names.data());
+        _names.clear();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::NamePool::setEnabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool gl::NamePool::isEnabled() const
+{
+    return _enabled;
+}
+
+void gl::NamePool::setBlockSize(size_t block_size)
+{
+    _block_size = (block_size > 0) ? block_size : 1;
+}
+
+size_t gl::NamePool::getBlockSize() const
+{
+    return _block_size;
+}
+
+size_t gl::NamePool::getAvailableCount() const
+{
+    return _names.size();
+}
+
+size_t gl::NamePool::getGenCallsCount() const
+{
+    return _gen_calls_count;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::NamePool::generate(size_t count)
+{
+    const size_t old_size = _names.size();
+
+    _names.resize(old_size + count, 0);
+    _gen_func(static_cast<int>(count), _names.data() + old_size);
+
+    ++_gen_calls_count;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::set_name_pools_enabled(bool enabled)
+{
+    get_name_pool<Buffer>           ().setEnabled(enabled);
+    get_name_pool<Texture>          ().setEnabled(enabled);
+    get_name_pool<FrameBuffer>      ().setEnabled(enabled);
+    get_name_pool<RenderBuffer>     ().setEnabled(enabled);
+    get_name_pool<VertexArrayObject>().setEnabled(enabled);
+}
+
+void gl::clear_name_pools()
+{
+    get_name_pool<Buffer>           ().clear();
+    get_name_pool<Texture>          ().clear();
+    get_name_pool<FrameBuffer>      ().clear();
+    get_name_pool<RenderBuffer>     ().clear();
+    get_name_pool<VertexArrayObject>().clear();
+}
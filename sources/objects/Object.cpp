@@ -1,9 +1,23 @@
 #include <gl_wrap/objects/Object.hpp>
 
+#include <utility> // for std::swap()
+
 gl::Object::Object()
     : _id(0)
 { }
 
+gl::Object::Object(gl::Object&& other)
+    : _id(other._id)
+{
+    other._id = 0;
+}
+
+gl::Object& gl::Object::operator = (gl::Object&& other)
+{
+    std::swap(_id, other._id);
+    return *this;
+}
+
 gl::Object::~Object()
 { }
 
@@ -0,0 +1,119 @@
+#include <gl_wrap/objects/OrphaningBuffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+#include <cstdio>  // for fprintf(), stderr
+#include <cstring> // for memcpy()
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+static constexpr int APPEND_ACCESS =
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+// -----------------------------------------------------------------------------
+
+gl::OrphaningBuffer::OrphaningBuffer(int target, size_t size, int usage)
+    : _buffer(target)
+    , _size(size)
+    , _usage(usage)
+    , _head(0)
+    , _orphans_count(0)
+{
+    _buffer.bind();
+    _buffer.setDataRaw(_size, nullptr, _usage);
+    _buffer.unbind();
+}
+
+gl::OrphaningBuffer::~OrphaningBuffer()
+{ }
+
+// -----------------------------------------------------------------------------
+
+gl::BufferMapping gl::OrphaningBuffer::appendMapping(size_t size, size_t alignment, long& offset)
+{
+    if(size > _size)
+    {
+        fprintf(stderr, "[GLWRAP] OrphaningBuffer: cannot append %zu bytes into buffer of %zu bytes!\n", size, _size);
+        fflush(stderr);
+
+        offset = -1;
+        return BufferMapping();
+    }
+
+    _buffer.bind();
+
+    size_t aligned = (_head + (alignment - 1)) & ~(alignment - 1);
+    if(aligned + size > _size)
+    {
+        orphan();
+        aligned = 0;
+    }
+
+    BufferMapping mapping = _buffer.map(aligned, size, APPEND_ACCESS);
+    if(!mapping.isOk())
+    {
+        offset = -1;
+        return mapping;
+    }
+
+    _head  = aligned + size;
+    offset = static_cast<long>(aligned);
+    return mapping;
+}
+
+long gl::OrphaningBuffer::append(const void* data, size_t size, size_t alignment)
+{
+    long offset = -1;
+
+    BufferMapping mapping = appendMapping(size, alignment, offset);
+    if(mapping.isOk())
+    {
+        memcpy(mapping.getPointer(), data, size);
+    }
+
+    return offset;
+}
+
+void gl::OrphaningBuffer::orphan()
+{
+    _buffer.bind();
+    _buffer.setDataRaw(_size, nullptr, _usage);
+
+    _head = 0;
+    ++_orphans_count;
+}
+
+void gl::OrphaningBuffer::resize(size_t size)
+{
+    _size = size;
+    orphan();
+}
+
+// -----------------------------------------------------------------------------
+
+gl::Buffer& gl::OrphaningBuffer::getBuffer()
+{
+    return _buffer;
+}
+
+size_t gl::OrphaningBuffer::getSize() const
+{
+    return _size;
+}
+
+int gl::OrphaningBuffer::getUsage() const
+{
+    return _usage;
+}
+
+size_t gl::OrphaningBuffer::getUsedSize() const
+{
+    return _head;
+}
+
+size_t gl::OrphaningBuffer::getOrphansCount() const
+{
+    return _orphans_count;
+}
+
+#endif
@@ -0,0 +1,362 @@
+#include <gl_wrap/objects/ProgramBinaryCache.hpp>
+#include <gl_wrap/objects/ShaderProgram.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#include <cstdio>  // for fopen(), fwrite(), rename(), remove(), snprintf()
+#include <cstring> // for memcmp(), memcpy(), strlen()
+#include <vector>
+
+#if defined(_WIN32)
+    #include <direct.h>  // for _mkdir()
+    #include <process.h> // for _getpid()
+#else
+    #include <fcntl.h>    // for open()
+    #include <sys/mman.h> // for mmap(), munmap()
+    #include <sys/stat.h> // for fstat(), mkdir()
+    #include <unistd.h>   // for close(), fsync(), getpid()
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*
+    Entry file layout:
+
+        EntryHeader
+        uint8_t binary[EntryHeader::binary_size]
+*/
+
+static constexpr char     ENTRY_MAGIC[4] = { 'G', 'L', 'P', 'B' };
+static constexpr uint32_t ENTRY_VERSION  = 1;
+
+struct EntryHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint32_t binary_format;
+    uint32_t binary_size;
+    uint64_t binary_hash;
+};
+
+// -----------------------------------------------------------------------------
+
+static constexpr uint64_t FNV64_OFFSET = 14695981039346656037ull;
+static constexpr uint64_t FNV64_PRIME  = 1099511628211ull;
+
+/// FNV-1a, 64 bit
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * FNV64_PRIME;
+    }
+
+    return hash;
+}
+
+/// Sources with length (so {"ab", "c"} != {"a", "bc"})
+static uint64_t hash_sources(uint64_t hash, const char** sources, int sources_count)
+{
+    hash = hash_bytes(hash, &sources_count, sizeof(sources_count));
+
+    for(int i = 0; i < sources_count; ++i)
+    {
+        const uint64_t length = strlen(sources[i]);
+
+        hash = hash_bytes(hash, &length, sizeof(length));
+        hash = hash_bytes(hash, sources[i], length);
+    }
+
+    return hash;
+}
+
+static std::string get_gl_string(GLenum name)
+{
+    const GLubyte* str = nullptr;
+    GLWRAP_GL_CHECK( str = glGetString(name) );
+
+    return (str != nullptr) ? std::string(reinterpret_cast<const char*>(str)) : std::string();
+}
+
+// -----------------------------------------------------------------------------
+
+/// Read-only file view: mmap()-ed, or read into memory (Windows)
+class MappedFile
+{
+    const unsigned char*       _data;
+    size_t                     _size;
+
+#if defined(_WIN32)
+    std::vector<unsigned char> _buffer;
+#endif
+
+public:
+
+    MappedFile() : _data(nullptr), _size(0) {}
+
+    ~MappedFile()
+    {
+#if !defined(_WIN32)
+        if(_data != nullptr)
+        {
+            munmap(const_cast<unsigned char*>(_data), _size);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path)
+    {
+#if defined(_WIN32)
+        FILE* file = fopen(path.c_str(), "rb");
+
+        if(file == nullptr)
+        {
+            return false;
+        }
+
+        fseek(file, 0, SEEK_END);
+        const long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if(size > 0)
+        {
+            _buffer.resize(static_cast<size_t>(size));
+
+            if(fread(_buffer.data(), 1, _buffer.size(), file) == _buffer.size())
+            {
+                _data = _buffer.data();
+                _size = _buffer.size();
+            }
+        }
+
+        fclose(file);
+        return (_data != nullptr);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+
+        if(fd == -1)
+        {
+            return false;
+        }
+
+        struct stat info;
+
+        if((fstat(fd, &info) == 0) && (info.st_size > 0))
+        {
+            void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if(mapped != MAP_FAILED)
+            {
+                _data = static_cast<const unsigned char*>(mapped);
+                _size = static_cast<size_t>(info.st_size);
+            }
+        }
+
+        // Mapping stays valid after close
+        close(fd);
+        return (_data != nullptr);
+#endif
+    }
+
+    inline const unsigned char* getData() const { return _data; }
+    inline size_t getSize() const { return _size; }
+};
+
+// -----------------------------------------------------------------------------
+
+gl::ProgramBinaryCache::ProgramBinaryCache(const std::string &directory)
+    : _directory(directory)
+    , _is_supported(ShaderProgram::isBinarySupported())
+    , _hits_count(0)
+    , _misses_count(0)
+    , _rejected_count(0)
+{
+    _driver_id = get_gl_string(GL_VENDOR)   + "\n" +
+                 get_gl_string(GL_RENDERER) + "\n" +
+                 get_gl_string(GL_VERSION);
+
+#if defined(_WIN32)
+    _mkdir(_directory.c_str());
+#else
+    mkdir(_directory.c_str(), 0755);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+uint64_t gl::ProgramBinaryCache::makeKey(
+        const char **vertex_sources,   int vertex_sources_count,
+        const char **fragment_sources, int fragment_sources_count) const
+{
+    uint64_t hash = FNV64_OFFSET;
+
+    hash = hash_bytes  (hash, _driver_id.data(), _driver_id.size());
+    hash = hash_sources(hash, vertex_sources,   vertex_sources_count);
+    hash = hash_sources(hash, fragment_sources, fragment_sources_count);
+
+    return hash;
+}
+
+bool gl::ProgramBinaryCache::load(uint64_t key, ShaderProgram &program)
+{
+    if(!_is_supported)
+    {
+        return false;
+    }
+
+    const std::string path = getEntryPath(key);
+
+    MappedFile file;
+
+    if(!file.open(path))
+    {
+        ++_misses_count;
+        return false;
+    }
+
+    EntryHeader header;
+
+    bool is_valid = (file.getSize() >= sizeof(header));
+
+    if(is_valid)
+    {
+        memcpy(&header, file.getData(), sizeof(header));
+
+        is_valid = (memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0) &&
+                   (header.version == ENTRY_VERSION) &&
+                   (header.key == key) &&
+                   (header.binary_size == file.getSize() - sizeof(header)) &&
+                   (hash_bytes(FNV64_OFFSET, file.getData() + sizeof(header), header.binary_size) == header.binary_hash);
+    }
+
+    if(!is_valid)
+    {
+        fprintf(stderr, "[GLWRAP] ProgramBinaryCache: damaged entry %s removed\n", path.c_str());
+        fflush(stderr);
+
+        ++_rejected_count;
+        remove(key);
+        return false;
+    }
+
+    program.loadBinary(header.binary_format, file.getData() + sizeof(header), header.binary_size);
+
+    if(!program.isLinked())
+    {
+        // Usually driver changed in a way, not visible in its strings
+        ++_rejected_count;
+        remove(key);
+        return false;
+    }
+
+    ++_hits_count;
+    return true;
+}
+
+bool gl::ProgramBinaryCache::store(uint64_t key, const ShaderProgram &program)
+{
+    if(!_is_supported)
+    {
+        return false;
+    }
+
+    unsigned int format = 0;
+    const std::vector<unsigned char> binary = program.getBinary(format);
+
+    if(binary.empty())
+    {
+        return false;
+    }
+
+    EntryHeader header;
+    memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.version       = ENTRY_VERSION;
+    header.key           = key;
+    header.binary_format = format;
+    header.binary_size   = static_cast<uint32_t>(binary.size());
+    header.binary_hash   = hash_bytes(FNV64_OFFSET, binary.data(), binary.size());
+
+    const std::string path = getEntryPath(key);
+
+    // Unique per process, so concurrent writers don't mix their data
+#if defined(_WIN32)
+    const std::string temp_path = path + ".tmp" + std::to_string(_getpid());
+#else
+    const std::string temp_path = path + ".tmp" + std::to_string(getpid());
+#endif
+
+    FILE* file = fopen(temp_path.c_str(), "wb");
+
+    if(file == nullptr)
+    {
+        return false;
+    }
+
+    bool is_written =
+        (fwrite(&header, sizeof(header), 1, file) == 1) &&
+        (fwrite(binary.data(), 1, binary.size(), file) == binary.size()) &&
+        (fflush(file) == 0);
+
+#if !defined(_WIN32)
+    // Data must be on disk before rename, otherwise crash may leave empty
+    // entry under final name
+    is_written = is_written && (fsync(fileno(file)) == 0);
+#endif
+
+    is_written = (fclose(file) == 0) && is_written;
+
+#if defined(_WIN32)
+    // rename() does not replace existing file on Windows
+    ::remove(path.c_str());
+#endif
+
+    if(!is_written || (rename(temp_path.c_str(), path.c_str()) != 0))
+    {
+        ::remove(temp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void gl::ProgramBinaryCache::remove(uint64_t key)
+{
+    ::remove(getEntryPath(key).c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+bool gl::ProgramBinaryCache::isSupported() const
+{
+    return _is_supported;
+}
+
+size_t gl::ProgramBinaryCache::getHitsCount() const
+{
+    return _hits_count;
+}
+
+size_t gl::ProgramBinaryCache::getMissesCount() const
+{
+    return _misses_count;
+}
+
+size_t gl::ProgramBinaryCache::getRejectedCount() const
+{
+    return _rejected_count;
+}
+
+std::string gl::ProgramBinaryCache::getEntryPath(uint64_t key) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+
+    return _directory + "/" + name;
+}
@@ -0,0 +1,497 @@
+#include <gl_wrap/objects/ProgramReflection.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+#include <gl_wrap/gl_version.hpp>
+
+#include <cstring>       // for strcmp(), strncmp(), strlen()
+#include <unordered_map>
+
+/// Whether stored name is 'name' or 'name' + "[0]" (arrays)
+static bool is_same_name(const char* stored_name, const char* name)
+{
+    if(strcmp(stored_name, name) == 0)
+    {
+        return true;
+    }
+
+    const size_t length = strlen(name);
+
+    return (strncmp(stored_name, name, length) == 0)
+        && (strcmp(stored_name + length, "[0]") == 0);
+}
+
+// -----------------------------------------------------------------------------
+
+gl::ProgramReflection::ProgramReflection()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::ProgramReflection::build(unsigned int program_id)
+{
+    clear();
+
+    // Each distinct name stored once
+    std::unordered_map<std::string, uint32_t> interned;
+
+    auto intern = [this, &interned](const GLchar* str, GLsizei length) -> uint32_t
+    {
+        const std::string name(str, length);
+
+        const auto found = interned.find(name);
+
+        if(found != interned.end())
+        {
+            return found->second;
+        }
+
+        const uint32_t offset = static_cast<uint32_t>(_strings.size());
+        _strings.append(name);
+        _strings.push_back('\0');
+
+        interned.emplace(name, offset);
+        return offset;
+    };
+
+    std::vector<GLchar> name_buffer;
+
+    // -------------------------------------------------------------------------
+    // Attributes
+
+    GLint attributes_count = 0;
+    GLint attribute_max_length = 0;
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_ATTRIBUTES, &attributes_count) );
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &attribute_max_length) );
+
+    name_buffer.assign(attribute_max_length + 1, '\0');
+    _attributes.reserve(attributes_count);
+
+    for(GLint i = 0; i < attributes_count; ++i)
+    {
+        GLsizei name_length = 0;
+        GLint   size = 0;
+        GLenum  type = 0;
+
+        GLWRAP_GL_CHECK( glGetActiveAttrib(program_id, i, static_cast<GLsizei>(name_buffer.size()), &name_length, &size, &type, name_buffer.data()) );
+
+        Attribute attribute;
+        attribute.name = intern(name_buffer.data(), name_length);
+        attribute.type = static_cast<int>(type);
+        attribute.size = size;
+        GLWRAP_GL_CHECK( attribute.location = glGetAttribLocation(program_id, name_buffer.data()) );
+
+        _attributes.push_back(attribute);
+    }
+
+    // -------------------------------------------------------------------------
+    // Uniforms
+
+    GLint uniforms_count = 0;
+    GLint uniform_max_length = 0;
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_UNIFORMS, &uniforms_count) );
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniform_max_length) );
+
+    name_buffer.assign(uniform_max_length + 1, '\0');
+    _uniforms.reserve(uniforms_count);
+
+    std::string element_name;
+
+    for(GLint i = 0; i < uniforms_count; ++i)
+    {
+        GLsizei name_length = 0;
+        GLint   size = 0;
+        GLenum  type = 0;
+
+        GLWRAP_GL_CHECK( glGetActiveUniform(program_id, i, static_cast<GLsizei>(name_buffer.size()), &name_length, &size, &type, name_buffer.data()) );
+
+        Uniform uniform;
+        uniform.name          = intern(name_buffer.data(), name_length);
+        uniform.type          = static_cast<int>(type);
+        uniform.size          = size;
+        uniform.first_element = static_cast<uint32_t>(_element_locations.size());
+        uniform.block_index   = -1;
+        uniform.offset        = -1;
+        uniform.array_stride  = -1;
+        uniform.matrix_stride = -1;
+        uniform.is_row_major  = false;
+        GLWRAP_GL_CHECK( uniform.location = glGetUniformLocation(program_id, name_buffer.data()) );
+
+        _element_locations.push_back(uniform.location);
+
+        // Array elements locations are not guaranteed to be sequential
+        const bool is_array = (name_length > 3) && (strcmp(name_buffer.data() + name_length - 3, "[0]") == 0);
+
+        for(GLint k = 1; k < size; ++k)
+        {
+            GLint element_location = -1;
+
+            if(is_array && (uniform.location != -1))
+            {
+                element_name.assign(name_buffer.data(), name_length - 3);
+                element_name += "[" + std::to_string(k) + "]";
+
+                GLWRAP_GL_CHECK( element_location = glGetUniformLocation(program_id, element_name.c_str()) );
+            }
+
+            _element_locations.push_back(element_location);
+        }
+
+        _uniforms.push_back(uniform);
+    }
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+    // -------------------------------------------------------------------------
+    // Uniforms :: blocks layout (all uniforms at once, per property)
+
+    if(uniforms_count > 0)
+    {
+        std::vector<GLuint> indices(uniforms_count);
+
+        for(GLint i = 0; i < uniforms_count; ++i)
+        {
+            indices[i] = static_cast<GLuint>(i);
+        }
+
+        std::vector<GLint> block_indices(uniforms_count);
+        std::vector<GLint> offsets(uniforms_count);
+        std::vector<GLint> array_strides(uniforms_count);
+        std::vector<GLint> matrix_strides(uniforms_count);
+        std::vector<GLint> row_majors(uniforms_count);
+
+        GLWRAP_GL_CHECK( glGetActiveUniformsiv(program_id, uniforms_count, indices.data(), GL_UNIFORM_BLOCK_INDEX,   block_indices.data()) );
+        GLWRAP_GL_CHECK( glGetActiveUniformsiv(program_id, uniforms_count, indices.data(), GL_UNIFORM_OFFSET,        offsets.data()) );
+        GLWRAP_GL_CHECK( glGetActiveUniformsiv(program_id, uniforms_count, indices.data(), GL_UNIFORM_ARRAY_STRIDE,  array_strides.data()) );
+        GLWRAP_GL_CHECK( glGetActiveUniformsiv(program_id, uniforms_count, indices.data(), GL_UNIFORM_MATRIX_STRIDE, matrix_strides.data()) );
+        GLWRAP_GL_CHECK( glGetActiveUniformsiv(program_id, uniforms_count, indices.data(), GL_UNIFORM_IS_ROW_MAJOR,  row_majors.data()) );
+
+        for(GLint i = 0; i < uniforms_count; ++i)
+        {
+            Uniform& uniform = _uniforms[i];
+
+            uniform.block_index   = block_indices[i];
+            uniform.offset        = offsets[i];
+            uniform.array_stride  = array_strides[i];
+            uniform.matrix_stride = matrix_strides[i];
+            uniform.is_row_major  = (row_majors[i] != 0);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Uniform blocks
+
+    GLint blocks_count = 0;
+    GLint block_max_length = 0;
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_BLOCKS, &blocks_count) );
+    GLWRAP_GL_CHECK( glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &block_max_length) );
+
+    name_buffer.assign(block_max_length + 1, '\0');
+    _uniform_blocks.reserve(blocks_count);
+
+    for(GLint i = 0; i < blocks_count; ++i)
+    {
+        GLsizei name_length = 0;
+        GLWRAP_GL_CHECK( glGetActiveUniformBlockName(program_id, i, static_cast<GLsizei>(name_buffer.size()), &name_length, name_buffer.data()) );
+
+        GLint binding = 0;
+        GLint data_size = 0;
+        GLWRAP_GL_CHECK( glGetActiveUniformBlockiv(program_id, i, GL_UNIFORM_BLOCK_BINDING, &binding) );
+        GLWRAP_GL_CHECK( glGetActiveUniformBlockiv(program_id, i, GL_UNIFORM_BLOCK_DATA_SIZE, &data_size) );
+
+        UniformBlock block;
+        block.name          = intern(name_buffer.data(), name_length);
+        block.index         = static_cast<unsigned int>(i);
+        block.binding       = static_cast<unsigned int>(binding);
+        block.data_size     = static_cast<size_t>(data_size);
+        block.first_member  = 0;
+        block.members_count = 0;
+
+        _uniform_blocks.push_back(block);
+    }
+
+    // Group members by block (counting sort, keeps uniforms order)
+    for(const Uniform& uniform : _uniforms)
+    {
+        if((uniform.block_index >= 0) && (uniform.block_index < blocks_count))
+        {
+            ++_uniform_blocks[uniform.block_index].members_count;
+        }
+    }
+
+    uint32_t members_offset = 0;
+
+    for(UniformBlock& block : _uniform_blocks)
+    {
+        block.first_member = members_offset;
+        members_offset += block.members_count;
+    }
+
+    _block_members.resize(members_offset);
+
+    std::vector<uint32_t> members_filled(_uniform_blocks.size(), 0);
+
+    for(size_t i = 0; i < _uniforms.size(); ++i)
+    {
+        const int block_index = _uniforms[i].block_index;
+
+        if((block_index >= 0) && (block_index < blocks_count))
+        {
+            const UniformBlock& block = _uniform_blocks[block_index];
+            _block_members[block.first_member + members_filled[block_index]++] = static_cast<uint32_t>(i);
+        }
+    }
+#endif
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+    // -------------------------------------------------------------------------
+    // Storage blocks
+
+    GLint storage_blocks_count = 0;
+    GLint storage_block_max_length = 0;
+    GLWRAP_GL_CHECK( glGetProgramInterfaceiv(program_id, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &storage_blocks_count) );
+    GLWRAP_GL_CHECK( glGetProgramInterfaceiv(program_id, GL_SHADER_STORAGE_BLOCK, GL_MAX_NAME_LENGTH, &storage_block_max_length) );
+
+    name_buffer.assign(storage_block_max_length + 1, '\0');
+    _storage_blocks.reserve(storage_blocks_count);
+
+    static const GLenum properties[] = { GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+
+    for(GLint i = 0; i < storage_blocks_count; ++i)
+    {
+        GLsizei name_length = 0;
+        GLWRAP_GL_CHECK( glGetProgramResourceName(program_id, GL_SHADER_STORAGE_BLOCK, i, static_cast<GLsizei>(name_buffer.size()), &name_length, name_buffer.data()) );
+
+        GLint values[2] = { 0, 0 };
+        GLWRAP_GL_CHECK( glGetProgramResourceiv(program_id, GL_SHADER_STORAGE_BLOCK, i, 2, properties, 2, nullptr, values) );
+
+        StorageBlock block;
+        block.name          = intern(name_buffer.data(), name_length);
+        block.index         = static_cast<unsigned int>(i);
+        block.binding       = static_cast<unsigned int>(values[0]);
+        block.data_size     = static_cast<size_t>(values[1]);
+        block.first_member  = 0;
+        block.members_count = 0;
+
+        _storage_blocks.push_back(block);
+    }
+
+    // -------------------------------------------------------------------------
+    // Storage blocks :: buffer variables
+
+    GLint variables_count = 0;
+    GLint variable_max_length = 0;
+    GLWRAP_GL_CHECK( glGetProgramInterfaceiv(program_id, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES, &variables_count) );
+    GLWRAP_GL_CHECK( glGetProgramInterfaceiv(program_id, GL_BUFFER_VARIABLE, GL_MAX_NAME_LENGTH, &variable_max_length) );
+
+    name_buffer.assign(variable_max_length + 1, '\0');
+
+    static const GLenum variable_properties[] = {
+        GL_TYPE, GL_ARRAY_SIZE, GL_BLOCK_INDEX, GL_OFFSET, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE,
+        GL_IS_ROW_MAJOR, GL_TOP_LEVEL_ARRAY_SIZE, GL_TOP_LEVEL_ARRAY_STRIDE
+    };
+
+    static constexpr GLsizei VARIABLE_PROPERTIES_COUNT = sizeof(variable_properties) / sizeof(variable_properties[0]);
+
+    std::vector<BufferVariable> variables;
+    variables.reserve(variables_count);
+
+    for(GLint i = 0; i < variables_count; ++i)
+    {
+        GLsizei name_length = 0;
+        GLWRAP_GL_CHECK( glGetProgramResourceName(program_id, GL_BUFFER_VARIABLE, i, static_cast<GLsizei>(name_buffer.size()), &name_length, name_buffer.data()) );
+
+        GLint values[VARIABLE_PROPERTIES_COUNT] = {};
+        GLWRAP_GL_CHECK( glGetProgramResourceiv(program_id, GL_BUFFER_VARIABLE, i, VARIABLE_PROPERTIES_COUNT, variable_properties, VARIABLE_PROPERTIES_COUNT, nullptr, values) );
+
+        BufferVariable variable;
+        variable.name                   = intern(name_buffer.data(), name_length);
+        variable.type                   = values[0];
+        variable.size                   = values[1];
+        variable.block_index            = values[2];
+        variable.offset                 = values[3];
+        variable.array_stride           = values[4];
+        variable.matrix_stride          = values[5];
+        variable.is_row_major           = (values[6] != 0);
+        variable.top_level_array_size   = values[7];
+        variable.top_level_array_stride = values[8];
+
+        if((variable.block_index >= 0) && (variable.block_index < storage_blocks_count))
+        {
+            ++_storage_blocks[variable.block_index].members_count;
+        }
+
+        variables.push_back(variable);
+    }
+
+    // Group by block (counting sort, keeps variables order)
+    uint32_t variables_offset = 0;
+
+    for(StorageBlock& block : _storage_blocks)
+    {
+        block.first_member = variables_offset;
+        variables_offset += block.members_count;
+    }
+
+    _buffer_variables.resize(variables_offset);
+
+    std::vector<uint32_t> variables_filled(_storage_blocks.size(), 0);
+
+    for(const BufferVariable& variable : variables)
+    {
+        const int block_index = variable.block_index;
+
+        if((block_index >= 0) && (block_index < storage_blocks_count))
+        {
+            const StorageBlock& block = _storage_blocks[block_index];
+            _buffer_variables[block.first_member + variables_filled[block_index]++] = variable;
+        }
+    }
+#endif
+}
+
+void gl::ProgramReflection::clear()
+{
+    _attributes.clear();
+    _uniforms.clear();
+    _element_locations.clear();
+    _uniform_blocks.clear();
+    _block_members.clear();
+    _storage_blocks.clear();
+    _buffer_variables.clear();
+    _strings.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+const std::vector<gl::ProgramReflection::Attribute>& gl::ProgramReflection::getAttributes() const
+{
+    return _attributes;
+}
+
+const std::vector<gl::ProgramReflection::Uniform>& gl::ProgramReflection::getUniforms() const
+{
+    return _uniforms;
+}
+
+const std::vector<gl::ProgramReflection::UniformBlock>& gl::ProgramReflection::getUniformBlocks() const
+{
+    return _uniform_blocks;
+}
+
+const std::vector<gl::ProgramReflection::StorageBlock>& gl::ProgramReflection::getStorageBlocks() const
+{
+    return _storage_blocks;
+}
+
+const std::vector<gl::ProgramReflection::BufferVariable>& gl::ProgramReflection::getBufferVariables() const
+{
+    return _buffer_variables;
+}
+
+const char* gl::ProgramReflection::getString(uint32_t offset) const
+{
+    return _strings.c_str() + offset;
+}
+
+int gl::ProgramReflection::getElementLocation(const Uniform& uniform, int element_index) const
+{
+    if((element_index < 0) || (element_index >= uniform.size))
+    {
+        return -1;
+    }
+
+    return _element_locations[uniform.first_element + element_index];
+}
+
+const gl::ProgramReflection::Uniform& gl::ProgramReflection::getBlockMember(const UniformBlock& block, uint32_t member_index) const
+{
+    return _uniforms[_block_members[block.first_member + member_index]];
+}
+
+const gl::ProgramReflection::BufferVariable& gl::ProgramReflection::getStorageBlockMember(const StorageBlock& block, uint32_t member_index) const
+{
+    return _buffer_variables[block.first_member + member_index];
+}
+
+void gl::ProgramReflection::setUniformBlockBinding(unsigned int block_index, unsigned int binding)
+{
+    if(block_index < _uniform_blocks.size())
+    {
+        _uniform_blocks[block_index].binding = binding;
+    }
+}
+
+void gl::ProgramReflection::setStorageBlockBinding(unsigned int block_index, unsigned int binding)
+{
+    if(block_index < _storage_blocks.size())
+    {
+        _storage_blocks[block_index].binding = binding;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+const gl::ProgramReflection::Attribute* gl::ProgramReflection::findAttribute(const char* name) const
+{
+    for(const Attribute& attribute : _attributes)
+    {
+        if(is_same_name(getString(attribute.name), name))
+        {
+            return &attribute;
+        }
+    }
+
+    return nullptr;
+}
+
+const gl::ProgramReflection::Uniform* gl::ProgramReflection::findUniform(const char* name) const
+{
+    for(const Uniform& uniform : _uniforms)
+    {
+        if(is_same_name(getString(uniform.name), name))
+        {
+            return &uniform;
+        }
+    }
+
+    return nullptr;
+}
+
+const gl::ProgramReflection::UniformBlock* gl::ProgramReflection::findUniformBlock(const char* name) const
+{
+    for(const UniformBlock& block : _uniform_blocks)
+    {
+        if(is_same_name(getString(block.name), name))
+        {
+            return &block;
+        }
+    }
+
+    return nullptr;
+}
+
+const gl::ProgramReflection::StorageBlock* gl::ProgramReflection::findStorageBlock(const char* name) const
+{
+    for(const StorageBlock& block : _storage_blocks)
+    {
+        if(is_same_name(getString(block.name), name))
+        {
+            return &block;
+        }
+    }
+
+    return nullptr;
+}
+
+const gl::ProgramReflection::BufferVariable* gl::ProgramReflection::findBufferVariable(const char* name) const
+{
+    for(const BufferVariable& variable : _buffer_variables)
+    {
+        if(is_same_name(getString(variable.name), name))
+        {
+            return &variable;
+        }
+    }
+
+    return nullptr;
+}
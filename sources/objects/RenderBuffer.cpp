@@ -1,7 +1,9 @@
 #include <gl_wrap/objects/RenderBuffer.hpp>
+#include <gl_wrap/objects/NamePool.hpp>
 
 #include <gl_wrap/gl_context.hpp>
 #include <gl_wrap/gl_error_checking.hpp>
+#include <gl_wrap/gl_dsa.hpp>
 
 #if defined(GLWRAP_CHECK_BINDED)
     #include <cassert> // for assert()
@@ -14,10 +16,37 @@
 
 // -----------------------------------------------------------------------------
 
+static void gen_renderbuffers(int n, gl::Object::id_t* ids)
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glCreateRenderbuffers(n, ids) );
+        return;
+    }
+#endif
+
+    GLWRAP_GL_CHECK( glGenRenderbuffers(n, ids) );
+}
+
+static void delete_renderbuffers(int n, const gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( glDeleteRenderbuffers(n, ids) );
+}
+
+template <>
+gl::NamePool& gl::get_name_pool<gl::RenderBuffer>()
+{
+    static NamePool pool(gen_renderbuffers, delete_renderbuffers);
+    return pool;
+}
+
+// -----------------------------------------------------------------------------
+
 gl::RenderBuffer::RenderBuffer()
     : Object()
 {
-    GLWRAP_GL_CHECK( glGenRenderbuffers(1, &_id) );
+    _id = get_name_pool<RenderBuffer>().acquire();
 }
 
 gl::RenderBuffer::~RenderBuffer()
@@ -41,6 +70,14 @@ void gl::RenderBuffer::unbind()
 
 void gl::RenderBuffer::setStorage(int internalFormat, int width, int height)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedRenderbufferStorage(_id, internalFormat, width, height) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_RENDERBUFFER;
 
     // TODO: check for:
@@ -54,6 +91,14 @@ void gl::RenderBuffer::setStorage(int internalFormat, int width, int height)
 #if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
 void gl::RenderBuffer::setStorageMultisample(int samples, int internalFormat, int width, int height)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glNamedRenderbufferStorageMultisample(_id, samples, internalFormat, width, height) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_RENDERBUFFER;
 
     // TODO: check for:
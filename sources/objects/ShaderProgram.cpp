@@ -3,6 +3,10 @@
 #include <gl_wrap/gl_context.hpp>
 #include <gl_wrap/gl_error_checking.hpp>
 
+#include <cstdio>  // for fprintf(), stderr
+#include <cstring> // for strcmp(), strlen(), strchr()
+#include <string>  // for std::to_string()
+
 #if defined(GLWRAP_CHECK_BINDED)
     #include <cassert> // for assert()
 
@@ -12,8 +16,45 @@
     #define GLWRAP_CHECK_BINDED_SHADER_PROGRAM
 #endif
 
+#if defined(GLWRAP_CHECK_UNIFORM_TYPES) && !defined(GLWRAP_CHECK_BINDED)
+    #include <cassert> // for assert()
+#endif
+
+// -----------------------------------------------------------------------------
+// Compile-time tests (hidden here, to execute them once, not on each include)
+
+static_assert(gl::uniform_type_traits<float          >::gl_type == GL_FLOAT,     "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::vec2 >::gl_type == GL_FLOAT_VEC2, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::vec3 >::gl_type == GL_FLOAT_VEC3, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::vec4 >::gl_type == GL_FLOAT_VEC4, "Test failed");
+static_assert(gl::uniform_type_traits<int            >::gl_type == GL_INT,       "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::ivec2>::gl_type == GL_INT_VEC2,  "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::ivec3>::gl_type == GL_INT_VEC3,  "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::ivec4>::gl_type == GL_INT_VEC4,  "Test failed");
+static_assert(gl::uniform_type_traits<bool           >::gl_type == GL_BOOL,      "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::mat2 >::gl_type == GL_FLOAT_MAT2, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::mat3 >::gl_type == GL_FLOAT_MAT3, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::mat4 >::gl_type == GL_FLOAT_MAT4, "Test failed");
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+static_assert(gl::uniform_type_traits<unsigned int   >::gl_type == GL_UNSIGNED_INT,      "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::uvec2>::gl_type == GL_UNSIGNED_INT_VEC2, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::uvec3>::gl_type == GL_UNSIGNED_INT_VEC3, "Test failed");
+static_assert(gl::uniform_type_traits<gl::glsl::uvec4>::gl_type == GL_UNSIGNED_INT_VEC4, "Test failed");
+#endif
+
+static_assert(sizeof(gl::glsl::vec3) ==  3 * sizeof(GLfloat), "Test failed");
+static_assert(sizeof(gl::glsl::mat3) ==  9 * sizeof(GLfloat), "Test failed");
+static_assert(sizeof(gl::glsl::mat4) == 16 * sizeof(GLfloat), "Test failed");
+
+static_assert(gl::UniformName("a").hash == gl::hash_uniform_name("a"), "Test failed");
+
+// -----------------------------------------------------------------------------
+
 gl::ShaderProgram::ShaderProgram()
     : Object()
+    , _resolved_uniforms()
+    , _is_uniform_values_cache_enabled(false)
 {
     GLWRAP_GL_CHECK( _id = glCreateProgram() );
 }
@@ -46,6 +87,22 @@ void gl::ShaderProgram::detachShader(const gl::Shader *shader)
 void gl::ShaderProgram::link()
 {
     GLWRAP_GL_CHECK( glLinkProgram(_id) );
+
+    onLinked();
+}
+
+void gl::ShaderProgram::onLinked()
+{
+    if(isLinked())
+    {
+        _reflection.build(_id);
+    }
+    else
+    {
+        _reflection.clear();
+    }
+
+    cacheUniformLocations();
 }
 
 void gl::ShaderProgram::validate()
@@ -53,6 +110,159 @@ void gl::ShaderProgram::validate()
     GLWRAP_GL_CHECK( glValidateProgram(_id) );
 }
 
+// -----------------------------------------------------------------------------
+
+// https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_get_program_binary.txt
+// https://www.khronos.org/registry/OpenGL/extensions/OES/OES_get_program_binary.txt
+
+using func_ptr_glGetProgramBinary   = void (*)(GLuint program, GLsizei buf_size, GLsizei* length, GLenum* binary_format, void* binary);
+using func_ptr_glProgramBinary      = void (*)(GLuint program, GLenum binary_format, const void* binary, GLsizei length);
+using func_ptr_glProgramParameteri  = void (*)(GLuint program, GLenum pname, GLint value);
+
+static func_ptr_glGetProgramBinary  my__glGetProgramBinary  = nullptr;
+static func_ptr_glProgramBinary     my__glProgramBinary     = nullptr;
+static func_ptr_glProgramParameteri my__glProgramParameteri = nullptr;
+
+// Same values in core, ARB & OES
+static constexpr GLenum MY_GL_PROGRAM_BINARY_LENGTH           = 0x8741;
+static constexpr GLenum MY_GL_NUM_PROGRAM_BINARY_FORMATS      = 0x87FE;
+static constexpr GLenum MY_GL_PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257;
+
+#if defined(GL_PROGRAM_BINARY_LENGTH)
+static_assert(MY_GL_PROGRAM_BINARY_LENGTH == GL_PROGRAM_BINARY_LENGTH, "Test failed");
+#endif
+#if defined(GL_NUM_PROGRAM_BINARY_FORMATS)
+static_assert(MY_GL_NUM_PROGRAM_BINARY_FORMATS == GL_NUM_PROGRAM_BINARY_FORMATS, "Test failed");
+#endif
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+static_assert(MY_GL_PROGRAM_BINARY_RETRIEVABLE_HINT == GL_PROGRAM_BINARY_RETRIEVABLE_HINT, "Test failed");
+#endif
+
+static bool BINARY_FUNCTIONS_INITED = false;
+
+static void init_binary_functions()
+{
+    // Only once
+    if(BINARY_FUNCTIONS_INITED == false)
+    {
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+        {
+            my__glGetProgramBinary  = glGetProgramBinary;
+            my__glProgramBinary     = glProgramBinary;
+            my__glProgramParameteri = glProgramParameteri;
+        }
+#elif defined(GLWRAP_GL_GLES) // GLES2 - 'GL_OES_get_program_binary' (no hint there)
+        {
+            my__glGetProgramBinary  = reinterpret_cast<func_ptr_glGetProgramBinary>( gl::getProcAddress("glGetProgramBinaryOES") );
+            my__glProgramBinary     = reinterpret_cast<func_ptr_glProgramBinary   >( gl::getProcAddress("glProgramBinaryOES") );
+        }
+#else // Desktop GL < 4.1 - 'GL_ARB_get_program_binary'
+        {
+            my__glGetProgramBinary  = reinterpret_cast<func_ptr_glGetProgramBinary >( gl::getProcAddress("glGetProgramBinary") );
+            my__glProgramBinary     = reinterpret_cast<func_ptr_glProgramBinary    >( gl::getProcAddress("glProgramBinary") );
+            my__glProgramParameteri = reinterpret_cast<func_ptr_glProgramParameteri>( gl::getProcAddress("glProgramParameteri") );
+        }
+#endif
+
+        BINARY_FUNCTIONS_INITED = true;
+    }
+}
+
+// Error flags are limited in count, but context loss may keep them set
+static void drain_gl_errors(bool is_report)
+{
+    for(int i = 0; i < 8; ++i)
+    {
+        const GLenum error_id = glGetError();
+        if(error_id == GL_NO_ERROR)
+        {
+            break;
+        }
+
+        if(is_report)
+        {
+            fprintf(stderr, "[GLWRAP] ShaderProgram: pending OpenGL error %08x (%s) before loading binary!\n", error_id, gl::gl_error_to_str(error_id));
+            fflush(stderr);
+        }
+    }
+}
+
+bool gl::ShaderProgram::isBinarySupported()
+{
+    init_binary_functions();
+
+    if((my__glGetProgramBinary == nullptr) || (my__glProgramBinary == nullptr))
+    {
+        return false;
+    }
+
+    GLint formats_count = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(MY_GL_NUM_PROGRAM_BINARY_FORMATS, &formats_count) );
+    return (formats_count > 0);
+}
+
+void gl::ShaderProgram::setBinaryRetrievableHint(bool is_retrievable)
+{
+    init_binary_functions();
+
+    if(my__glProgramParameteri != nullptr)
+    {
+        GLWRAP_GL_CHECK( my__glProgramParameteri(_id, MY_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, (is_retrievable ? GL_TRUE : GL_FALSE)) );
+    }
+}
+
+std::vector<unsigned char> gl::ShaderProgram::getBinary(unsigned int &format) const
+{
+    init_binary_functions();
+
+    std::vector<unsigned char> result;
+
+    if((my__glGetProgramBinary == nullptr) || !isLinked())
+    {
+        return result;
+    }
+
+    GLint length = 0;
+    GLWRAP_GL_CHECK( glGetProgramiv(_id, MY_GL_PROGRAM_BINARY_LENGTH, &length) );
+
+    if(length <= 0)
+    {
+        return result;
+    }
+
+    result.resize(length);
+
+    GLsizei written = 0;
+    GLenum  binary_format = 0;
+    GLWRAP_GL_CHECK( my__glGetProgramBinary(_id, length, &written, &binary_format, result.data()) );
+
+    result.resize(written);
+    format = binary_format;
+    return result;
+}
+
+void gl::ShaderProgram::loadBinary(unsigned int format, const void *data, size_t size)
+{
+    init_binary_functions();
+
+    if(my__glProgramBinary == nullptr)
+    {
+        return;
+    }
+
+    // Errors of previous (unchecked) calls are not ours to drop silently
+    drain_gl_errors(true);
+
+    // Rejected binary gives GL_INVALID_ENUM / GL_INVALID_VALUE on some
+    // drivers - it's expected, so only its errors are dropped. Success
+    // is decided by GL_LINK_STATUS (see onLinked() / isLinked())
+    my__glProgramBinary(_id, format, data, static_cast<GLsizei>(size));
+
+    drain_gl_errors(false);
+
+    onLinked();
+}
+
 void gl::ShaderProgram::use()
 {
     GLWRAP_GL_CHECK( glUseProgram(_id) );
@@ -88,17 +298,292 @@ gl::ShaderProgram::attribute_location gl::ShaderProgram::getAttribLocation(const
 
 gl::ShaderProgram::uniform_location gl::ShaderProgram::getUniformLocation(const char *name) const
 {
-    GLint result;
+    int result;
+
+    if(_uniform_locations.find(name, result))
+    {
+        return result;
+    }
+
+    // Not active uniform, or not-listed name form (like "array[0].member"),
+    // so ask GL once
     GLWRAP_GL_CHECK( result = glGetUniformLocation(_id, name) );
+    _uniform_locations.insert(name, result);
     return result;
 }
 
+gl::ShaderProgram::uniform_location gl::ShaderProgram::getUniformLocation(const UniformName& id) const
+{
+    int result;
+
+    if(_uniform_locations.find(id.name, id.hash, result))
+    {
+        return result;
+    }
+
+    GLWRAP_GL_CHECK( result = glGetUniformLocation(_id, id.name) );
+    _uniform_locations.insert(id.name, result);
+    return result;
+}
+
+/// Size of single value of uniform of non-opaque type (0 - sampler, image,
+/// atomic counter, etc.)
+static size_t get_basic_uniform_type_size(GLenum type)
+{
+    switch(type)
+    {
+        case GL_FLOAT:      return 1 * sizeof(GLfloat);
+        case GL_FLOAT_VEC2: return 2 * sizeof(GLfloat);
+        case GL_FLOAT_VEC3: return 3 * sizeof(GLfloat);
+        case GL_FLOAT_VEC4: return 4 * sizeof(GLfloat);
+
+        case GL_INT:        return 1 * sizeof(GLint);
+        case GL_INT_VEC2:   return 2 * sizeof(GLint);
+        case GL_INT_VEC3:   return 3 * sizeof(GLint);
+        case GL_INT_VEC4:   return 4 * sizeof(GLint);
+
+        case GL_BOOL:       return 1 * sizeof(GLint);
+        case GL_BOOL_VEC2:  return 2 * sizeof(GLint);
+        case GL_BOOL_VEC3:  return 3 * sizeof(GLint);
+        case GL_BOOL_VEC4:  return 4 * sizeof(GLint);
+
+        case GL_FLOAT_MAT2: return  4 * sizeof(GLfloat);
+        case GL_FLOAT_MAT3: return  9 * sizeof(GLfloat);
+        case GL_FLOAT_MAT4: return 16 * sizeof(GLfloat);
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(2, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT3x2: return  6 * sizeof(GLfloat);
+        case GL_FLOAT_MAT2x4:
+        case GL_FLOAT_MAT4x2: return  8 * sizeof(GLfloat);
+        case GL_FLOAT_MAT3x4:
+        case GL_FLOAT_MAT4x3: return 12 * sizeof(GLfloat);
+#endif
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+        case GL_UNSIGNED_INT:      return 1 * sizeof(GLuint);
+        case GL_UNSIGNED_INT_VEC2: return 2 * sizeof(GLuint);
+        case GL_UNSIGNED_INT_VEC3: return 3 * sizeof(GLuint);
+        case GL_UNSIGNED_INT_VEC4: return 4 * sizeof(GLuint);
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 0)
+        case GL_DOUBLE:      return 1 * sizeof(GLdouble);
+        case GL_DOUBLE_VEC2: return 2 * sizeof(GLdouble);
+        case GL_DOUBLE_VEC3: return 3 * sizeof(GLdouble);
+        case GL_DOUBLE_VEC4: return 4 * sizeof(GLdouble);
+
+        case GL_DOUBLE_MAT2: return  4 * sizeof(GLdouble);
+        case GL_DOUBLE_MAT3: return  9 * sizeof(GLdouble);
+        case GL_DOUBLE_MAT4: return 16 * sizeof(GLdouble);
+
+        case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT3x2: return  6 * sizeof(GLdouble);
+        case GL_DOUBLE_MAT2x4:
+        case GL_DOUBLE_MAT4x2: return  8 * sizeof(GLdouble);
+        case GL_DOUBLE_MAT3x4:
+        case GL_DOUBLE_MAT4x3: return 12 * sizeof(GLdouble);
+#endif
+
+        default:
+            return 0;
+    }
+}
+
+/// Size of single value of uniform of given type, as passed to glUniform*()
+static size_t get_uniform_type_size(GLenum type)
+{
+    const size_t size = get_basic_uniform_type_size(type);
+
+    // Samplers & images - set by glUniform1i()
+    return (size != 0) ? size : sizeof(GLint);
+}
+
+void gl::ShaderProgram::cacheUniformLocations()
+{
+    _uniform_locations.clear();
+    _uniform_values.clear();
+
+    for(ResolvedUniform& resolved : _resolved_uniforms)
+    {
+        resolved = ResolvedUniform{ nullptr, 0, 0, -1 };
+    }
+
+    std::string base_name;
+    std::string element_name;
+
+    for(const ProgramReflection::Uniform& uniform : _reflection.getUniforms())
+    {
+        const char* name = _reflection.getString(uniform.name);
+
+        _uniform_locations.insert(name, uniform.location);
+
+        if(_is_uniform_values_cache_enabled)
+        {
+            _uniform_values.addUniform(uniform.location, get_uniform_type_size(uniform.type), uniform.size);
+        }
+
+        // Arrays listed as "name[0]" - also cache "name" & all elements
+        const size_t name_length = strlen(name);
+
+        if((name_length > 3) && (strcmp(name + name_length - 3, "[0]") == 0))
+        {
+            base_name.assign(name, name_length - 3);
+            _uniform_locations.insert(base_name.c_str(), uniform.location);
+
+            for(int k = 1; k < uniform.size; ++k)
+            {
+                const int element_location = _reflection.getElementLocation(uniform, k);
+
+                element_name = base_name + "[" + std::to_string(k) + "]";
+                _uniform_locations.insert(element_name.c_str(), element_location);
+
+                if(_is_uniform_values_cache_enabled)
+                {
+                    _uniform_values.addArrayElement(element_location, uniform.location, k);
+                }
+            }
+        }
+    }
+}
+
+bool gl::ShaderProgram::isUniformValueShadowed(int location, const void *data, size_t size)
+{
+    return _is_uniform_values_cache_enabled
+        && _uniform_values.update(location, data, size);
+}
+
+int gl::ShaderProgram::resolveUniformSlow(const UniformName& id, int gl_type)
+{
+    const int location = getUniformLocation(id).location;
+
+    if(location != -1)
+    {
+        checkUniformType(id.name, location, gl_type);
+    }
+    else
+    {
+        reportMissingUniform(id.name);
+    }
+
+    ResolvedUniform& resolved = _resolved_uniforms[id.hash & (RESOLVED_UNIFORMS_COUNT - 1)];
+    resolved.name     = id.name;
+    resolved.hash     = id.hash;
+    resolved.gl_type  = gl_type;
+    resolved.location = location;
+
+    return location;
+}
+
+void gl::ShaderProgram::reportMissingUniform(const char *name)
+{
+    if(_uniform_locations.markReported(name))
+    {
+        fprintf(stderr, "[GLWRAP] Cannot find uniform: %s (program %u)\n", name, _id);
+        fflush(stderr);
+    }
+}
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+unsigned int gl::ShaderProgram::getUniformBlockIndex(const char *name) const
+{
+    GLuint result;
+    GLWRAP_GL_CHECK( result = glGetUniformBlockIndex(_id, name) );
+    return result;
+}
+
+void gl::ShaderProgram::setUniformBlockBinding(unsigned int block_index, unsigned int binding)
+{
+    GLWRAP_GL_CHECK( glUniformBlockBinding(_id, block_index, binding) );
+    _reflection.setUniformBlockBinding(block_index, binding);
+}
+
+bool gl::ShaderProgram::setUniformBlockBinding(const char *name, unsigned int binding)
+{
+    const unsigned int block_index = getUniformBlockIndex(name);
+
+    if(block_index == GL_INVALID_INDEX)
+    {
+        return false;
+    }
+
+    setUniformBlockBinding(block_index, binding);
+    return true;
+}
+
+size_t gl::ShaderProgram::getUniformBlockDataSize(unsigned int block_index) const
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetActiveUniformBlockiv(_id, block_index, GL_UNIFORM_BLOCK_DATA_SIZE, &result) );
+    return static_cast<size_t>(result);
+}
+#endif
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+unsigned int gl::ShaderProgram::getStorageBlockIndex(const char *name) const
+{
+    GLuint result;
+    GLWRAP_GL_CHECK( result = glGetProgramResourceIndex(_id, GL_SHADER_STORAGE_BLOCK, name) );
+    return result;
+}
+
+std::vector<gl::ShaderProgram::storage_block_info> gl::ShaderProgram::getStorageBlocks() const
+{
+    // Already queried on link (see onLinked())
+    const std::vector<ProgramReflection::StorageBlock>& blocks = _reflection.getStorageBlocks();
+
+    std::vector<storage_block_info> result;
+    result.reserve(blocks.size());
+
+    for(const ProgramReflection::StorageBlock& block : blocks)
+    {
+        storage_block_info info;
+        info.name      = _reflection.getString(block.name);
+        info.index     = block.index;
+        info.binding   = block.binding;
+        info.data_size = block.data_size;
+
+        result.push_back(info);
+    }
+
+    return result;
+}
+#endif
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 3)
+void gl::ShaderProgram::setStorageBlockBinding(unsigned int block_index, unsigned int binding)
+{
+    GLWRAP_GL_CHECK( glShaderStorageBlockBinding(_id, block_index, binding) );
+    _reflection.setStorageBlockBinding(block_index, binding);
+}
+
+bool gl::ShaderProgram::setStorageBlockBinding(const char *name, unsigned int binding)
+{
+    const unsigned int block_index = getStorageBlockIndex(name);
+
+    if(block_index == GL_INVALID_INDEX)
+    {
+        return false;
+    }
+
+    setStorageBlockBinding(block_index, binding);
+    return true;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 void gl::ShaderProgram::setUniformFloat(gl::ShaderProgram::uniform_location location, float v0)
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLfloat values[] = { v0 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform1f(location, v0) );
 }
 
@@ -106,6 +591,13 @@ void gl::ShaderProgram::setUniformFloat(gl::ShaderProgram::uniform_location loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLfloat values[] = { v0, v1 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform2f(location, v0, v1) );
 }
 
@@ -113,6 +605,13 @@ void gl::ShaderProgram::setUniformFloat(gl::ShaderProgram::uniform_location loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLfloat values[] = { v0, v1, v2 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform3f(location, v0, v1, v2) );
 }
 
@@ -120,6 +619,13 @@ void gl::ShaderProgram::setUniformFloat(gl::ShaderProgram::uniform_location loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLfloat values[] = { v0, v1, v2, v3 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform4f(location, v0, v1, v2, v3) );
 }
 
@@ -128,8 +634,7 @@ void gl::ShaderProgram::setUniformFloat(gl::ShaderProgram::uniform_location loca
     if(location.isPresent()) { \
         FUNC_SET_VALUES_AT_LOCATION(location, __VA_ARGS__ ); \
     } else { \
-        fprintf(stderr, "[GLWRAP] Cannot find uniform: %s\n", name); \
-        fflush(stderr); \
+        reportMissingUniform(name); \
     }
 
 
@@ -167,6 +672,13 @@ void gl::ShaderProgram::setUniformInt(gl::ShaderProgram::uniform_location locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLint values[] = { v0 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform1i(location, v0) );
 }
 
@@ -174,6 +686,13 @@ void gl::ShaderProgram::setUniformInt(gl::ShaderProgram::uniform_location locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLint values[] = { v0, v1 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform2i(location, v0, v1) );
 }
 
@@ -181,6 +700,13 @@ void gl::ShaderProgram::setUniformInt(gl::ShaderProgram::uniform_location locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLint values[] = { v0, v1, v2 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform3i(location, v0, v1, v2) );
 }
 
@@ -188,6 +714,13 @@ void gl::ShaderProgram::setUniformInt(gl::ShaderProgram::uniform_location locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    const GLint values[] = { v0, v1, v2, v3 };
+
+    if(isUniformValueShadowed(location, values, sizeof(values)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform4i(location, v0, v1, v2, v3) );
 }
 
@@ -241,6 +774,11 @@ void gl::ShaderProgram::setUniformFloatArray1Ptr(gl::ShaderProgram::uniform_loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 1 * sizeof(GLfloat) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform1fv(location, count, value) );
 }
 
@@ -248,6 +786,11 @@ void gl::ShaderProgram::setUniformFloatArray2Ptr(gl::ShaderProgram::uniform_loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 2 * sizeof(GLfloat) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform2fv(location, count, value) );
 }
 
@@ -255,6 +798,11 @@ void gl::ShaderProgram::setUniformFloatArray3Ptr(gl::ShaderProgram::uniform_loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 3 * sizeof(GLfloat) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform3fv(location, count, value) );
 }
 
@@ -262,6 +810,11 @@ void gl::ShaderProgram::setUniformFloatArray4Ptr(gl::ShaderProgram::uniform_loca
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 4 * sizeof(GLfloat) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform4fv(location, count, value) );
 }
 
@@ -299,6 +852,11 @@ void gl::ShaderProgram::setUniformIntArray1Ptr(gl::ShaderProgram::uniform_locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 1 * sizeof(GLint) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform1iv(location, count, value) );
 }
 
@@ -306,6 +864,11 @@ void gl::ShaderProgram::setUniformIntArray2Ptr(gl::ShaderProgram::uniform_locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 2 * sizeof(GLint) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform2iv(location, count, value) );
 }
 
@@ -313,6 +876,11 @@ void gl::ShaderProgram::setUniformIntArray3Ptr(gl::ShaderProgram::uniform_locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 3 * sizeof(GLint) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform3iv(location, count, value) );
 }
 
@@ -320,6 +888,11 @@ void gl::ShaderProgram::setUniformIntArray4Ptr(gl::ShaderProgram::uniform_locati
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    if(isUniformValueShadowed(location, value, 4 * sizeof(GLint) * count))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniform4iv(location, count, value) );
 }
 
@@ -353,6 +926,58 @@ void gl::ShaderProgram::setUniformIntArray4Ptr(const char *name, const int *valu
 
 // -----------------------------------------------------------------------------
 
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void gl::ShaderProgram::setUniformUIntArray1Ptr(gl::ShaderProgram::uniform_location location, const unsigned int *value, int count)
+{
+    GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
+
+    if(isUniformValueShadowed(location, value, 1 * sizeof(GLuint) * count))
+    {
+        return;
+    }
+
+    GLWRAP_GL_CHECK( glUniform1uiv(location, count, value) );
+}
+
+void gl::ShaderProgram::setUniformUIntArray2Ptr(gl::ShaderProgram::uniform_location location, const unsigned int *value, int count)
+{
+    GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
+
+    if(isUniformValueShadowed(location, value, 2 * sizeof(GLuint) * count))
+    {
+        return;
+    }
+
+    GLWRAP_GL_CHECK( glUniform2uiv(location, count, value) );
+}
+
+void gl::ShaderProgram::setUniformUIntArray3Ptr(gl::ShaderProgram::uniform_location location, const unsigned int *value, int count)
+{
+    GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
+
+    if(isUniformValueShadowed(location, value, 3 * sizeof(GLuint) * count))
+    {
+        return;
+    }
+
+    GLWRAP_GL_CHECK( glUniform3uiv(location, count, value) );
+}
+
+void gl::ShaderProgram::setUniformUIntArray4Ptr(gl::ShaderProgram::uniform_location location, const unsigned int *value, int count)
+{
+    GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
+
+    if(isUniformValueShadowed(location, value, 4 * sizeof(GLuint) * count))
+    {
+        return;
+    }
+
+    GLWRAP_GL_CHECK( glUniform4uiv(location, count, value) );
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 void gl::ShaderProgram::setUniformFloatArray1(uniform_location location, const float (&array)[1])
 {
     setUniformFloatArray1Ptr(location, array);
@@ -439,6 +1064,16 @@ void gl::ShaderProgram::setUniformMatrix2(gl::ShaderProgram::uniform_location lo
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    // Transposed values are not shadowed (same bytes - different matrix)
+    if(transpose)
+    {
+        _uniform_values.invalidate(location);
+    }
+    else if(isUniformValueShadowed(location, values, 4 * sizeof(GLfloat)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniformMatrix2fv(location, 1, (transpose ? GL_TRUE : GL_FALSE), values) );
 }
 
@@ -446,6 +1081,16 @@ void gl::ShaderProgram::setUniformMatrix3(gl::ShaderProgram::uniform_location lo
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    // Transposed values are not shadowed (same bytes - different matrix)
+    if(transpose)
+    {
+        _uniform_values.invalidate(location);
+    }
+    else if(isUniformValueShadowed(location, values, 9 * sizeof(GLfloat)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniformMatrix3fv(location, 1, (transpose ? GL_TRUE : GL_FALSE), values) );
 }
 
@@ -453,6 +1098,16 @@ void gl::ShaderProgram::setUniformMatrix4(gl::ShaderProgram::uniform_location lo
 {
     GLWRAP_CHECK_BINDED_SHADER_PROGRAM;
 
+    // Transposed values are not shadowed (same bytes - different matrix)
+    if(transpose)
+    {
+        _uniform_values.invalidate(location);
+    }
+    else if(isUniformValueShadowed(location, values, 16 * sizeof(GLfloat)))
+    {
+        return;
+    }
+
     GLWRAP_GL_CHECK( glUniformMatrix4fv(location, 1, (transpose ? GL_TRUE : GL_FALSE), values) );
 }
 
@@ -479,6 +1134,191 @@ void gl::ShaderProgram::setUniformMatrix4(const char *name, const float *values,
 
 // -----------------------------------------------------------------------------
 
+void gl::ShaderProgram::setUniformValuesCacheEnabled(bool is_enabled)
+{
+    if(_is_uniform_values_cache_enabled == is_enabled)
+    {
+        return;
+    }
+
+    _is_uniform_values_cache_enabled = is_enabled;
+
+    // Layout is registered from active uniforms (re-read them, if already linked)
+    cacheUniformLocations();
+}
+
+bool gl::ShaderProgram::isUniformValuesCacheEnabled() const
+{
+    return _is_uniform_values_cache_enabled;
+}
+
+void gl::ShaderProgram::invalidateUniformValuesCache()
+{
+    _uniform_values.invalidateAll();
+}
+
+const gl::UniformValueCache& gl::ShaderProgram::getUniformValuesCache() const
+{
+    return _uniform_values;
+}
+
+void gl::ShaderProgram::resetUniformValuesCacheCounters()
+{
+    _uniform_values.resetCounters();
+}
+
+// -----------------------------------------------------------------------------
+
+#if defined(GLWRAP_CHECK_UNIFORM_TYPES)
+/// Whether uniform of 'actual_type' may be set by glUniform*() for 'set_type'
+static bool is_uniform_type_compatible(GLenum actual_type, GLenum set_type)
+{
+    if(actual_type == set_type)
+    {
+        return true;
+    }
+
+    // Samplers & images are set as int
+    if(get_basic_uniform_type_size(actual_type) == 0)
+    {
+        return (set_type == GL_INT);
+    }
+
+    // Scalar bool may be set by any scalar
+    if(actual_type == GL_BOOL)
+    {
+        return (set_type == GL_INT) || (set_type == GL_FLOAT)
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+            || (set_type == GL_UNSIGNED_INT)
+#endif
+            ;
+    }
+
+    return false;
+}
+#endif
+
+void gl::ShaderProgram::checkUniformType(const char *name, int location, int gl_type) const
+{
+#if defined(GLWRAP_CHECK_UNIFORM_TYPES)
+    if(location == -1)
+    {
+        return;
+    }
+
+    // Array element ("lights[2]") is listed as "lights[0]"
+    const char* index_pos = strchr(name, '[');
+
+    const std::string base_name = (index_pos != nullptr)
+        ? std::string(name, index_pos - name)
+        : std::string(name);
+
+    const ProgramReflection::Uniform* uniform = _reflection.findUniform(base_name.c_str());
+
+    if(uniform == nullptr)
+    {
+        return;
+    }
+
+    if(!is_uniform_type_compatible(static_cast<GLenum>(uniform->type), static_cast<GLenum>(gl_type)))
+    {
+        fprintf(stderr, "[GLWRAP] Uniform %s has type 0x%04X, but set as 0x%04X (program %u)\n", name, uniform->type, gl_type, _id);
+        fflush(stderr);
+        assert(false);
+    }
+#else
+    (void)name;
+    (void)location;
+    (void)gl_type;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::ShaderProgram::setUniformValue(int location, float value)
+{
+    setUniformFloat(location, value);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::vec2 &value)
+{
+    setUniformFloatArray2Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::vec3 &value)
+{
+    setUniformFloatArray3Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::vec4 &value)
+{
+    setUniformFloatArray4Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, int value)
+{
+    setUniformInt(location, value);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::ivec2 &value)
+{
+    setUniformIntArray2Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::ivec3 &value)
+{
+    setUniformIntArray3Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::ivec4 &value)
+{
+    setUniformIntArray4Ptr(location, &value.x);
+}
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+void gl::ShaderProgram::setUniformValue(int location, unsigned int value)
+{
+    setUniformUIntArray1Ptr(location, &value);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::uvec2 &value)
+{
+    setUniformUIntArray2Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::uvec3 &value)
+{
+    setUniformUIntArray3Ptr(location, &value.x);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::uvec4 &value)
+{
+    setUniformUIntArray4Ptr(location, &value.x);
+}
+#endif
+
+void gl::ShaderProgram::setUniformValue(int location, bool value)
+{
+    setUniformBool(location, value);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::mat2 &value)
+{
+    setUniformMatrix2(location, value.values);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::mat3 &value)
+{
+    setUniformMatrix3(location, value.values);
+}
+
+void gl::ShaderProgram::setUniformValue(int location, const glsl::mat4 &value)
+{
+    setUniformMatrix4(location, value.values);
+}
+
+// -----------------------------------------------------------------------------
+
 bool gl::ShaderProgram::isDeleted() const
 {
     GLint status;
@@ -602,6 +1442,11 @@ bool gl::ShaderProgram::isOk() const
     return (result != GL_FALSE);
 }
 
+const gl::ProgramReflection& gl::ShaderProgram::getReflection() const
+{
+    return _reflection;
+}
+
 const char *gl::get_shader_variable_type_str(int type)
 {
     switch (type) {
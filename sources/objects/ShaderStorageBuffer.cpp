@@ -0,0 +1,103 @@
+#include <gl_wrap/objects/ShaderStorageBuffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+
+gl::ShaderStorageBuffer::ShaderStorageBuffer(int usage, size_t size)
+    : _buffer(GL_SHADER_STORAGE_BUFFER)
+    , _usage(usage)
+    , _size(size)
+{
+    _buffer.bind();
+    _buffer.setDataRaw(_size, nullptr, _usage);
+}
+
+gl::ShaderStorageBuffer::~ShaderStorageBuffer()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::ShaderStorageBuffer::resize(size_t size)
+{
+    if(size == _size)
+    {
+        return;
+    }
+
+    _buffer.bind();
+    _buffer.setDataRaw(size, nullptr, _usage);
+    _size = size;
+}
+
+void gl::ShaderStorageBuffer::setDataRaw(size_t size, const void* data)
+{
+    _buffer.bind();
+
+    // Avoid storage re-specification - but null 'data' has nothing to copy,
+    // so it falls through to orphaning (like glBufferData() with null does)
+    if( (size == _size) && (data != nullptr) )
+    {
+        _buffer.setSubDataRaw(0, size, data);
+        return;
+    }
+
+    _buffer.setDataRaw(size, data, _usage);
+    _size = size;
+}
+
+void gl::ShaderStorageBuffer::setSubDataRaw(long offset, size_t size, const void* data)
+{
+    _buffer.bind();
+    _buffer.setSubDataRaw(offset, size, data);
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::ShaderStorageBuffer::bindBase(unsigned int binding)
+{
+    _buffer.bindBase(binding);
+}
+
+void gl::ShaderStorageBuffer::bindRange(unsigned int binding, long offset, size_t size)
+{
+    _buffer.bindRange(binding, offset, size);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::ShaderStorageBuffer::getSize() const
+{
+    return _size;
+}
+
+gl::Buffer& gl::ShaderStorageBuffer::getBuffer()
+{
+    return _buffer;
+}
+
+// -----------------------------------------------------------------------------
+
+int gl::ShaderStorageBuffer::getOffsetAlignment()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &result) );
+    return result;
+}
+
+int gl::ShaderStorageBuffer::getMaxBlockSize()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &result) );
+    return result;
+}
+
+int gl::ShaderStorageBuffer::getMaxBindings()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &result) );
+    return result;
+}
+
+#endif
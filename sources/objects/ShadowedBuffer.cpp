@@ -0,0 +1,139 @@
+#include <gl_wrap/objects/ShadowedBuffer.hpp>
+
+#include <gl_wrap/utils/byte_range.hpp>
+
+#include <algorithm> // for std::sort(), std::max()
+#include <cassert>
+#include <cstdio>    // for fprintf(), stderr
+#include <cstring>   // for memcpy()
+
+gl::ShadowedBuffer::ShadowedBuffer(int target, size_t size, int usage, size_t gap_threshold)
+    : _buffer(target)
+    , _shadow(size, 0)
+    , _gap_threshold(gap_threshold)
+    , _bytes_written(0)
+    , _last_report{0, 0, 0}
+{
+    // Initial upload, so GPU-side content matches (zeroed) shadow copy
+    _buffer.bind();
+    _buffer.setDataRaw(size, _shadow.data(), usage);
+    _buffer.unbind();
+}
+
+gl::ShadowedBuffer::~ShadowedBuffer()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::ShadowedBuffer::write(size_t offset, const void* data, size_t size)
+{
+    const size_t shadow_size = _shadow.size();
+
+    if(!is_byte_range_inside(offset, size, shadow_size))
+    {
+        fprintf(stderr, "[GLWRAP] ShadowedBuffer: cannot write %zu bytes at offset %zu into buffer of %zu bytes!\n", size, offset, shadow_size);
+        fflush(stderr);
+
+        assert(false);
+        return;
+    }
+
+    memcpy(_shadow.data() + offset, data, size);
+    markDirty(offset, size);
+}
+
+unsigned char* gl::ShadowedBuffer::getData()
+{
+    return _shadow.data();
+}
+
+const unsigned char* gl::ShadowedBuffer::getData() const
+{
+    return _shadow.data();
+}
+
+void gl::ShadowedBuffer::markDirty(size_t offset, size_t size)
+{
+    if(size > 0)
+    {
+        _dirty.push_back({offset, offset + size});
+        _bytes_written += size;
+    }
+}
+
+const gl::ShadowedBuffer::FlushReport& gl::ShadowedBuffer::flush()
+{
+    _last_report = {_bytes_written, 0, 0};
+    _bytes_written = 0;
+
+    if(_dirty.empty())
+    {
+        return _last_report;
+    }
+
+    std::sort(_dirty.begin(), _dirty.end(),
+              [](const Interval& a, const Interval& b) { return a.begin < b.begin; });
+
+    _buffer.bind();
+
+    const auto upload = [this](const Interval& interval)
+    {
+        const size_t size = interval.end - interval.begin;
+        _buffer.setSubDataRaw(interval.begin, size, _shadow.data() + interval.begin);
+
+        _last_report.bytes_uploaded += size;
+        _last_report.uploads_count  += 1;
+    };
+
+    Interval current = _dirty.front();
+    for(size_t i = 1; i < _dirty.size(); ++i)
+    {
+        const Interval& next = _dirty[i];
+        if(next.begin <= current.end + _gap_threshold)
+        {
+            current.end = std::max(current.end, next.end);
+        }
+        else
+        {
+            upload(current);
+            current = next;
+        }
+    }
+    upload(current);
+
+    _dirty.clear();
+
+    return _last_report;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::ShadowedBuffer::setGapThreshold(size_t gap_threshold)
+{
+    _gap_threshold = gap_threshold;
+}
+
+size_t gl::ShadowedBuffer::getGapThreshold() const
+{
+    return _gap_threshold;
+}
+
+const gl::ShadowedBuffer::FlushReport& gl::ShadowedBuffer::getLastFlushReport() const
+{
+    return _last_report;
+}
+
+size_t gl::ShadowedBuffer::getSize() const
+{
+    return _shadow.size();
+}
+
+bool gl::ShadowedBuffer::isDirty() const
+{
+    return !_dirty.empty();
+}
+
+gl::Buffer& gl::ShadowedBuffer::getBuffer()
+{
+    return _buffer;
+}
@@ -0,0 +1,147 @@
+#include <gl_wrap/objects/StreamingRingBuffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+#include <cassert> // for assert()
+#include <cstdio>  // for fprintf(), stderr
+
+#if GLWRAP_GL_FROM_OPENGL_VER(4, 4)
+
+static constexpr int STORAGE_FLAGS =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+// -----------------------------------------------------------------------------
+
+gl::StreamingRingBuffer::StreamingRingBuffer(int target, size_t region_size, size_t regions_count)
+    : _buffer(target)
+    , _region_size(region_size)
+    , _regions_count(regions_count)
+    , _current_region(0)
+    , _head(0)
+    , _mapped(nullptr)
+    , _fences(regions_count)
+{
+    // No regions means nothing to cycle through (and modulo by zero in endFrame())
+    if( (_region_size == 0) || (_regions_count == 0) )
+    {
+        fprintf(stderr, "[GLWRAP] StreamingRingBuffer: cannot create %zu regions of %zu bytes!\n", _regions_count, _region_size);
+        fflush(stderr);
+
+        assert(false);
+        return;
+    }
+
+    const size_t total_size = _region_size * _regions_count;
+
+    _buffer.bind();
+    _buffer.setStorageRaw(total_size, nullptr, STORAGE_FLAGS);
+    _mapped = static_cast<unsigned char*>( _buffer.mapRangeRaw(0, total_size, STORAGE_FLAGS) );
+    _buffer.unbind();
+
+    if(_mapped == nullptr)
+    {
+        fprintf(stderr, "[GLWRAP] StreamingRingBuffer: cannot map %zu bytes!\n", total_size);
+        fflush(stderr);
+    }
+}
+
+gl::StreamingRingBuffer::~StreamingRingBuffer()
+{
+    if(_mapped != nullptr)
+    {
+        _buffer.bind();
+        _buffer.unmap();
+        _buffer.unbind();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::StreamingRingBuffer::beginFrame()
+{
+    if(_mapped == nullptr)
+    {
+        return;
+    }
+
+    Fence& fence = _fences[_current_region];
+    if(fence.isInserted())
+    {
+        fence.wait();
+        fence.reset();
+    }
+
+    _head = 0;
+}
+
+void gl::StreamingRingBuffer::endFrame()
+{
+    if(_mapped == nullptr)
+    {
+        return;
+    }
+
+    _fences[_current_region].insert();
+
+    _current_region = (_current_region + 1) % _regions_count;
+    _head = 0;
+}
+
+gl::StreamingRingBuffer::Allocation gl::StreamingRingBuffer::allocate(size_t size, size_t alignment)
+{
+    // Align absolute offset (not offset inside region), since GL requirements
+    // (like GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT) are related to whole buffer
+    const size_t step          = (alignment > 0) ? alignment : 1;
+    const size_t region_offset = getRegionOffset();
+    const size_t aligned       = ((region_offset + _head + (step - 1)) / step) * step - region_offset;
+
+    // Called per draw - so no logging here, caller checks returned allocation
+    if( (_mapped == nullptr) || (aligned > _region_size) || (size > _region_size - aligned) )
+    {
+        return {nullptr, 0, 0};
+    }
+
+    _head = aligned + size;
+
+    const size_t offset = region_offset + aligned;
+    return {_mapped + offset, offset, size};
+}
+
+// -----------------------------------------------------------------------------
+
+gl::Buffer& gl::StreamingRingBuffer::getBuffer()
+{
+    return _buffer;
+}
+
+size_t gl::StreamingRingBuffer::getRegionSize() const
+{
+    return _region_size;
+}
+
+size_t gl::StreamingRingBuffer::getRegionsCount() const
+{
+    return _regions_count;
+}
+
+size_t gl::StreamingRingBuffer::getCurrentRegion() const
+{
+    return _current_region;
+}
+
+size_t gl::StreamingRingBuffer::getRegionOffset() const
+{
+    return _current_region * _region_size;
+}
+
+size_t gl::StreamingRingBuffer::getUsedSize() const
+{
+    return _head;
+}
+
+bool gl::StreamingRingBuffer::isOk() const
+{
+    return (_mapped != nullptr);
+}
+
+#endif
@@ -1,7 +1,9 @@
 #include <gl_wrap/objects/Texture.hpp>
+#include <gl_wrap/objects/NamePool.hpp>
 
 #include <gl_wrap/gl_context.hpp>
 #include <gl_wrap/gl_error_checking.hpp>
+#include <gl_wrap/gl_dsa.hpp>
 
 #if defined(GLWRAP_CHECK_BINDED)
     #include <cassert> // for assert()
@@ -14,11 +16,49 @@
 
 // -----------------------------------------------------------------------------
 
+static void gen_textures(int n, gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( glGenTextures(n, ids) );
+}
+
+static void delete_textures(int n, const gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( glDeleteTextures(n, ids) );
+}
+
+template <>
+gl::NamePool& gl::get_name_pool<gl::Texture>()
+{
+    static NamePool pool(gen_textures, delete_textures);
+    return pool;
+}
+
+template <>
+bool gl::is_name_pool_used<gl::Texture>()
+{
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    return !GLWRAP_GL_DSA_ENABLED();
+#else
+    return true;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
 gl::Texture::Texture(int target)
     : Object()
     , _target(target)
 {
-    GLWRAP_GL_CHECK( glGenTextures(1, &_id) );
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        // Not pooled, since glCreateTextures() creates textures of exact target
+        GLWRAP_GL_CHECK( glCreateTextures(_target, 1, &_id) );
+        return;
+    }
+#endif
+
+    _id = get_name_pool<Texture>().acquire();
 }
 
 gl::Texture::~Texture()
@@ -70,6 +110,14 @@ void gl::Texture::setImage3D(int level, int internalFormat, int width, int heigh
 #if !defined(GLWRAP_GL_GLES)
 void gl::Texture::setSubImage1D(int level, int xoffset, int width, int format, int type, const void *pixels)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureSubImage1D(_id, level, xoffset, width, format, type, pixels) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexSubImage1D(_target, level, xoffset, width, format, type, pixels) );
@@ -78,6 +126,14 @@ void gl::Texture::setSubImage1D(int level, int xoffset, int width, int format, i
 
 void gl::Texture::setSubImage2D(int level, int xoffset, int yoffset, int width, int height, int format, int type, const void *pixels)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureSubImage2D(_id, level, xoffset, yoffset, width, height, format, type, pixels) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexSubImage2D(_target, level, xoffset, yoffset, width, height, format, type, pixels) );
@@ -86,6 +142,14 @@ void gl::Texture::setSubImage2D(int level, int xoffset, int yoffset, int width,
 #if defined(GLWRAP_GL_OPENGL) || GLWRAP_GL_FROM_GLES_VER(3, 0)
 void gl::Texture::setSubImage3D(int level, int xoffset, int yoffset, int zoffset, int width, int height, int depth, int format, int type, const void *pixels)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureSubImage3D(_id, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexSubImage3D(_target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels) );
@@ -96,6 +160,14 @@ void gl::Texture::setSubImage3D(int level, int xoffset, int yoffset, int zoffset
 
 void gl::Texture::setWrapS(int value)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureParameteri(_id, GL_TEXTURE_WRAP_S, value) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexParameteri(_target, GL_TEXTURE_WRAP_S, value) );
@@ -103,6 +175,14 @@ void gl::Texture::setWrapS(int value)
 
 void gl::Texture::setWrapT(int value)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureParameteri(_id, GL_TEXTURE_WRAP_T, value) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexParameteri(_target, GL_TEXTURE_WRAP_T, value) );
@@ -112,6 +192,14 @@ void gl::Texture::setWrapT(int value)
 
 void gl::Texture::setMagFilter(int value)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureParameteri(_id, GL_TEXTURE_MAG_FILTER, value) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexParameteri(_target, GL_TEXTURE_MAG_FILTER, value) );
@@ -119,6 +207,14 @@ void gl::Texture::setMagFilter(int value)
 
 void gl::Texture::setMinFilter(int value)
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLWRAP_GL_CHECK( glTextureParameteri(_id, GL_TEXTURE_MIN_FILTER, value) );
+        return;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLWRAP_GL_CHECK( glTexParameteri(_target, GL_TEXTURE_MIN_FILTER, value) );
@@ -128,23 +224,17 @@ void gl::Texture::setMinFilter(int value)
 
 void gl::Texture::setWrapST(int valueS, int valueT)
 {
-    GLWRAP_CHECK_BINDED_TEXTURE;
-
     setWrapS(valueS);
     setWrapT(valueT);
 }
 
 void gl::Texture::setWrapST(int value)
 {
-    GLWRAP_CHECK_BINDED_TEXTURE;
-
     setWrapST(value, value);
 }
 
 void gl::Texture::setMinMagFilter(int valueMin, int valueMag)
 {
-    GLWRAP_CHECK_BINDED_TEXTURE;
-
     setMinFilter(valueMin);
     setMagFilter(valueMag);
 }
@@ -159,6 +249,15 @@ void gl::Texture::setMinMagFilter(int value)
 #if (GLWRAP_GL_FROM_OPENGL_VER(2, 0) || GLWRAP_GL_FROM_GLES_VER(3, 1))
 int gl::Texture::getWidth(int level) const
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLint result;
+        GLWRAP_GL_CHECK( glGetTextureLevelParameteriv(_id, level, GL_TEXTURE_WIDTH, &result) );
+        return result;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLint result;
@@ -168,6 +267,15 @@ int gl::Texture::getWidth(int level) const
 
 int gl::Texture::getHeight(int level) const
 {
+#if defined(GLWRAP_GL_DSA_AVAILABLE)
+    if(GLWRAP_GL_DSA_ENABLED())
+    {
+        GLint result;
+        GLWRAP_GL_CHECK( glGetTextureLevelParameteriv(_id, level, GL_TEXTURE_HEIGHT, &result) );
+        return result;
+    }
+#endif
+
     GLWRAP_CHECK_BINDED_TEXTURE;
 
     GLint result;
@@ -0,0 +1,95 @@
+#include <gl_wrap/objects/UniformBuffer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+#include <gl_wrap/gl_error_checking.hpp>
+
+#include <algorithm> // for std::max()
+#include <cassert>   // for assert()
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 1) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+
+gl::UniformBuffer::UniformBuffer(size_t slot_size, size_t slots_count, int usage)
+    : _buffer(GL_UNIFORM_BUFFER)
+    , _slot_size(slot_size)
+    , _slot_stride(slot_size)
+    , _slots_count(slots_count)
+{
+    if(_slots_count > 1)
+    {
+        // Failed query (or broken driver) gives 0 - no alignment then
+        const size_t alignment = static_cast<size_t>( std::max(getOffsetAlignment(), 1) );
+
+        _slot_stride = ((_slot_size + alignment - 1) / alignment) * alignment;
+    }
+
+    _buffer.bind();
+    _buffer.setDataRaw(_slot_stride * _slots_count, nullptr, usage);
+}
+
+gl::UniformBuffer::~UniformBuffer()
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::UniformBuffer::setSlotRaw(size_t slot, const void* data, size_t size)
+{
+    assert(slot < _slots_count);
+    assert(size <= _slot_size);
+
+    _buffer.bind();
+    _buffer.setSubDataRaw(slot * _slot_stride, size, data);
+}
+
+void gl::UniformBuffer::bindSlot(unsigned int binding, size_t slot)
+{
+    assert(slot < _slots_count);
+
+    _buffer.bindRange(binding, slot * _slot_stride, _slot_size);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::UniformBuffer::getSlotSize() const
+{
+    return _slot_size;
+}
+
+size_t gl::UniformBuffer::getSlotStride() const
+{
+    return _slot_stride;
+}
+
+size_t gl::UniformBuffer::getSlotsCount() const
+{
+    return _slots_count;
+}
+
+gl::Buffer& gl::UniformBuffer::getBuffer()
+{
+    return _buffer;
+}
+
+// -----------------------------------------------------------------------------
+
+int gl::UniformBuffer::getOffsetAlignment()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &result) );
+    return result;
+}
+
+int gl::UniformBuffer::getMaxBlockSize()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &result) );
+    return result;
+}
+
+int gl::UniformBuffer::getMaxBindings()
+{
+    GLint result = 0;
+    GLWRAP_GL_CHECK( glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &result) );
+    return result;
+}
+
+#endif
@@ -0,0 +1,156 @@
+#include <gl_wrap/objects/UniformLocationCache.hpp>
+
+#include <cstring> // for strcmp()
+
+// -----------------------------------------------------------------------------
+// Compile-time tests (hidden here, to execute them once, not on each include)
+
+static_assert(gl::hash_uniform_name("")  == 2166136261u, "Test failed");
+static_assert(gl::hash_uniform_name("a") == 0xE40C292Cu, "Test failed");
+
+// -----------------------------------------------------------------------------
+
+static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+static constexpr size_t INITIAL_CAPACITY = 16;
+
+uint32_t gl::hash_uniform_name_runtime(const char* name)
+{
+    uint32_t hash = 2166136261u;
+
+    for(; *name != '\0'; ++name)
+    {
+        hash = (hash ^ static_cast<uint32_t>(static_cast<uint8_t>(*name))) * 16777619u;
+    }
+
+    return hash;
+}
+
+// -----------------------------------------------------------------------------
+
+gl::UniformLocationCache::UniformLocationCache()
+    : _count(0)
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::UniformLocationCache::clear()
+{
+    _entries.clear();
+    _names_pool.clear();
+    _count = 0;
+}
+
+void gl::UniformLocationCache::insert(const char* name, int location)
+{
+    // Keep load factor <= 0.5
+    if((_count + 1) * 2 > _entries.size())
+    {
+        grow();
+    }
+
+    const uint32_t hash = hash_uniform_name_runtime(name);
+    Entry& entry = _entries[findSlot(name, hash)];
+
+    if(entry.name_offset == EMPTY_SLOT)
+    {
+        entry.hash        = hash;
+        entry.name_offset = static_cast<uint32_t>(_names_pool.size());
+        entry.is_reported = false;
+
+        _names_pool.append(name);
+        _names_pool.push_back('\0');
+
+        ++_count;
+    }
+
+    entry.location = location;
+}
+
+bool gl::UniformLocationCache::find(const char* name, int& location) const
+{
+    return find(name, hash_uniform_name_runtime(name), location);
+}
+
+bool gl::UniformLocationCache::find(const char* name, uint32_t hash, int& location) const
+{
+    if(_entries.empty())
+    {
+        return false;
+    }
+
+    const Entry& entry = _entries[findSlot(name, hash)];
+
+    if(entry.name_offset == EMPTY_SLOT)
+    {
+        return false;
+    }
+
+    location = entry.location;
+    return true;
+}
+
+bool gl::UniformLocationCache::markReported(const char* name)
+{
+    if(_entries.empty())
+    {
+        return false;
+    }
+
+    Entry& entry = _entries[findSlot(name, hash_uniform_name_runtime(name))];
+
+    if((entry.name_offset == EMPTY_SLOT) || entry.is_reported)
+    {
+        return false;
+    }
+
+    entry.is_reported = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::UniformLocationCache::getCount() const
+{
+    return _count;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::UniformLocationCache::findSlot(const char* name, uint32_t hash) const
+{
+    const size_t mask = _entries.size() - 1;
+
+    for(size_t slot = (hash & mask); ; slot = ((slot + 1) & mask))
+    {
+        const Entry& entry = _entries[slot];
+
+        if(entry.name_offset == EMPTY_SLOT)
+        {
+            return slot;
+        }
+
+        if((entry.hash == hash) && (strcmp(_names_pool.c_str() + entry.name_offset, name) == 0))
+        {
+            return slot;
+        }
+    }
+}
+
+void gl::UniformLocationCache::grow()
+{
+    const size_t new_capacity = _entries.empty() ? INITIAL_CAPACITY : (_entries.size() * 2);
+
+    std::vector<Entry> old_entries(new_capacity, Entry{ 0, EMPTY_SLOT, -1, false });
+    old_entries.swap(_entries);
+
+    for(const Entry& entry : old_entries)
+    {
+        if(entry.name_offset == EMPTY_SLOT)
+        {
+            continue;
+        }
+
+        _entries[findSlot(_names_pool.c_str() + entry.name_offset, entry.hash)] = entry;
+    }
+}
@@ -0,0 +1,152 @@
+#include <gl_wrap/objects/UniformValueCache.hpp>
+
+#include <algorithm> // for std::fill()
+#include <cstring>   // for memcmp(), memcpy(), memset()
+
+gl::UniformValueCache::UniformValueCache()
+    : _hits_count(0)
+    , _misses_count(0)
+{ }
+
+// -----------------------------------------------------------------------------
+
+void gl::UniformValueCache::clear()
+{
+    _slots.clear();
+    _values.clear();
+    _is_known.clear();
+}
+
+void gl::UniformValueCache::addUniform(int location, size_t element_size, size_t array_size)
+{
+    if((location < 0) || (element_size == 0) || (array_size == 0))
+    {
+        return;
+    }
+
+    if(static_cast<size_t>(location) >= _slots.size())
+    {
+        _slots.resize(location + 1, Slot{0, 0, 0, 0});
+    }
+
+    Slot& slot = _slots[location];
+
+    slot.offset        = static_cast<uint32_t>(_values.size());
+    slot.capacity      = static_cast<uint32_t>(element_size * array_size);
+    slot.element_size  = static_cast<uint32_t>(element_size);
+    slot.first_element = static_cast<uint32_t>(_is_known.size());
+
+    _values.resize(_values.size() + slot.capacity, 0);
+    _is_known.resize(_is_known.size() + array_size, 0);
+}
+
+void gl::UniformValueCache::addArrayElement(int location, int base_location, size_t element_index)
+{
+    if((location < 0) || !isRegistered(base_location))
+    {
+        return;
+    }
+
+    const Slot base = _slots[base_location];
+
+    if(element_index * base.element_size >= base.capacity)
+    {
+        return;
+    }
+
+    if(static_cast<size_t>(location) >= _slots.size())
+    {
+        _slots.resize(location + 1, Slot{0, 0, 0, 0});
+    }
+
+    Slot& slot = _slots[location];
+
+    slot.offset        = base.offset + static_cast<uint32_t>(element_index * base.element_size);
+    slot.capacity      = base.capacity - static_cast<uint32_t>(element_index * base.element_size);
+    slot.element_size  = base.element_size;
+    slot.first_element = base.first_element + static_cast<uint32_t>(element_index);
+}
+
+bool gl::UniformValueCache::update(int location, const void *data, size_t size)
+{
+    // Not registered or invalid size (GL call will fail, values stay same)
+    if(!isRegistered(location) || (size == 0))
+    {
+        ++_misses_count;
+        return false;
+    }
+
+    const Slot& slot = _slots[location];
+
+    if((size > slot.capacity) || (size % slot.element_size != 0))
+    {
+        ++_misses_count;
+        return false;
+    }
+
+    unsigned char* stored = &_values[slot.offset];
+    unsigned char* known  = &_is_known[slot.first_element];
+
+    const size_t elements_count = size / slot.element_size;
+
+    bool is_all_known = true;
+
+    for(size_t i = 0; i < elements_count; ++i)
+    {
+        is_all_known = is_all_known && (known[i] != 0);
+    }
+
+    if(is_all_known && (memcmp(stored, data, size) == 0))
+    {
+        ++_hits_count;
+        return true;
+    }
+
+    memcpy(stored, data, size);
+    memset(known, 1, elements_count);
+
+    ++_misses_count;
+    return false;
+}
+
+void gl::UniformValueCache::invalidate(int location)
+{
+    if(!isRegistered(location))
+    {
+        return;
+    }
+
+    const Slot& slot = _slots[location];
+
+    memset(&_is_known[slot.first_element], 0, slot.capacity / slot.element_size);
+}
+
+void gl::UniformValueCache::invalidateAll()
+{
+    std::fill(_is_known.begin(), _is_known.end(), 0);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::UniformValueCache::getHitsCount() const
+{
+    return _hits_count;
+}
+
+size_t gl::UniformValueCache::getMissesCount() const
+{
+    return _misses_count;
+}
+
+void gl::UniformValueCache::resetCounters()
+{
+    _hits_count   = 0;
+    _misses_count = 0;
+}
+
+bool gl::UniformValueCache::isRegistered(int location) const
+{
+    return (location >= 0)
+        && (static_cast<size_t>(location) < _slots.size())
+        && (_slots[location].capacity != 0);
+}
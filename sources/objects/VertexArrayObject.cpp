@@ -1,4 +1,6 @@
 #include <gl_wrap/objects/VertexArrayObject.hpp>
+#include <gl_wrap/objects/NamePool.hpp>
+#include <gl_wrap/objects/Buffer.hpp>
 
 #include <gl_wrap/gl_context.hpp>
 
@@ -6,7 +8,10 @@
 #include <gl_wrap/gl_error_checking.hpp>
 #include <gl_wrap/gl_extensions.hpp>
 
-#include <cstdio> // for fprintf(), stderr
+#include <algorithm> // for std::equal(), std::max()
+#include <cassert>   // for assert()
+#include <cstdio>    // for fprintf(), stderr
+#include <unordered_map>
 
 using func_ptr_glGenVertexArrays    = void      (*)(GLsizei n,       GLuint *arrays);
 using func_ptr_glDeleteVertexArrays = void      (*)(GLsizei n, const GLuint *arrays);
@@ -15,31 +20,156 @@ using func_ptr_glIsVertexArray      = GLboolean (*)(GLuint array);
 
 // -----------------------------------------------------------------------------
 
-static void dummy_glGenVertexArrays(GLsizei n, GLuint *arrays)
+/*
+    Software emulation of VAOs, used when neither core functions nor
+    'GL_OES_vertex_array_object' available (some GLES2 devices).
+
+    Attribute state, specified via VertexArrayObject::apply() and element
+    buffer, binded via VertexArrayObject::bindElementBuffer(), is recorded
+    into emulated VAO on CPU. On bind, only attributes which differ from
+    currently applied state (the one of previously binded emulated VAO) are
+    re-specified.
+
+    NOTE: GL_ARRAY_BUFFER binding is changed on bind, when pointers replayed.
+
+    VAOs are not shared between contexts, so (like binding tracker below) all
+    emulated state is thread-local - one per context, while each context is
+    used from own thread. Only the choice of emulation is process-wide, since
+    it depends on driver's procedures, not on context.
+*/
+
+static constexpr unsigned int EMULATED_MAX_ATTRIBUTES = 16;
+
+struct EmulatedAttribute
+{
+    bool        enabled;
+    GLuint      buffer;
+    GLint       components;
+    GLenum      type;
+    GLboolean   normalized;
+    GLsizei     stride;
+    const void* pointer;
+
+    inline bool isPointerSame(const EmulatedAttribute& other) const
+    {
+        return
+                (buffer     == other.buffer)     &&
+                (components == other.components) &&
+                (type       == other.type)       &&
+                (normalized == other.normalized) &&
+                (stride     == other.stride)     &&
+                (pointer    == other.pointer);
+    }
+};
+
+struct EmulatedVertexArray
 {
-    fprintf(stderr, "[GLWRAP] :: glGenVertexArrays(%d, %p) not supported!\n", n, arrays);
+    EmulatedAttribute attributes[EMULATED_MAX_ATTRIBUTES];
+    GLuint            element_buffer;
+};
+
+static bool IS_EMULATED = false;
+
+static thread_local std::unordered_map<GLuint, EmulatedVertexArray> EMULATED_ARRAYS; // 0 - default VAO
+static thread_local EmulatedVertexArray EMULATED_APPLIED_STATE = {}; // What is in GL now
+static thread_local GLuint              EMULATED_BINDED_ID     = 0;
+static thread_local GLuint              EMULATED_NEXT_ID       = 1;
+
+static void emulated_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    for(GLsizei i = 0; i < n; ++i)
+    {
+        arrays[i] = EMULATED_NEXT_ID++;
+        EMULATED_ARRAYS[arrays[i]] = EmulatedVertexArray();
+    }
 }
 
-static void dummy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+static void emulated_glBindVertexArray(GLuint array);
+
+static void emulated_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
-    fprintf(stderr, "[GLWRAP] :: glDeleteVertexArrays(%d, %p) not supported!\n", n, arrays);
+    for(GLsizei i = 0; i < n; ++i)
+    {
+        if((arrays[i] != 0) && (arrays[i] == EMULATED_BINDED_ID))
+        {
+            emulated_glBindVertexArray(0);
+        }
+
+        if(arrays[i] != 0)
+        {
+            EMULATED_ARRAYS.erase(arrays[i]);
+        }
+    }
 }
 
-static void dummy_glBindVertexArray(GLuint array)
+static void emulated_glBindVertexArray(GLuint array)
 {
-    fprintf(stderr, "[GLWRAP] :: glBindVertexArray(%u) not supported!\n", array);
+    const EmulatedVertexArray& target = EMULATED_ARRAYS[array];
+    EmulatedVertexArray&       applied = EMULATED_APPLIED_STATE;
+
+    for(GLuint location = 0; location < EMULATED_MAX_ATTRIBUTES; ++location)
+    {
+        const EmulatedAttribute& wanted  = target.attributes[location];
+        EmulatedAttribute&       current = applied.attributes[location];
+
+        if(wanted.enabled && !wanted.isPointerSame(current))
+        {
+            GLWRAP_GL_CHECK( glBindBuffer(GL_ARRAY_BUFFER, wanted.buffer) );
+            GLWRAP_GL_CHECK( glVertexAttribPointer(location, wanted.components, wanted.type,
+                                                   wanted.normalized, wanted.stride, wanted.pointer) );
+            current = wanted; // Pointer of disabled attribute is kept by GL
+        }
+
+        if(wanted.enabled != current.enabled)
+        {
+            if(wanted.enabled)
+            {
+                GLWRAP_GL_CHECK( glEnableVertexAttribArray(location) );
+            }
+            else
+            {
+                GLWRAP_GL_CHECK( glDisableVertexAttribArray(location) );
+            }
+
+            current.enabled = wanted.enabled;
+        }
+    }
+
+    if(target.element_buffer != applied.element_buffer)
+    {
+        GLWRAP_GL_CHECK( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, target.element_buffer) );
+        applied.element_buffer = target.element_buffer;
+    }
+
+    EMULATED_BINDED_ID = array;
 }
 
-static GLboolean dummy_glIsVertexArray(GLuint array)
+static GLboolean emulated_glIsVertexArray(GLuint array)
 {
-    fprintf(stderr, "[GLWRAP] :: glIsVertexArray(%u) not supported!\n", array);
-    return GL_FALSE;
+    return ((array != 0) && (EMULATED_ARRAYS.count(array) > 0)) ? GL_TRUE : GL_FALSE;
 }
 
-static func_ptr_glGenVertexArrays    my__glGenVertexArrays    = dummy_glGenVertexArrays;
-static func_ptr_glDeleteVertexArrays my__glDeleteVertexArrays = dummy_glDeleteVertexArrays;
-static func_ptr_glBindVertexArray    my__glBindVertexArray    = dummy_glBindVertexArray;
-static func_ptr_glIsVertexArray      my__glIsVertexArray      = dummy_glIsVertexArray;
+/// Records attribute state, just specified in GL, into binded emulated VAO
+static void emulated_record_attribute(GLuint location, const EmulatedAttribute& attribute)
+{
+    assert(location < EMULATED_MAX_ATTRIBUTES);
+
+    EMULATED_APPLIED_STATE.attributes[location]                 = attribute;
+    EMULATED_ARRAYS[EMULATED_BINDED_ID].attributes[location]    = attribute;
+}
+
+static void emulated_record_attribute_enabled(GLuint location, bool enabled)
+{
+    assert(location < EMULATED_MAX_ATTRIBUTES);
+
+    EMULATED_APPLIED_STATE.attributes[location].enabled              = enabled;
+    EMULATED_ARRAYS[EMULATED_BINDED_ID].attributes[location].enabled = enabled;
+}
+
+static func_ptr_glGenVertexArrays    my__glGenVertexArrays    = emulated_glGenVertexArrays;
+static func_ptr_glDeleteVertexArrays my__glDeleteVertexArrays = emulated_glDeleteVertexArrays;
+static func_ptr_glBindVertexArray    my__glBindVertexArray    = emulated_glBindVertexArray;
+static func_ptr_glIsVertexArray      my__glIsVertexArray      = emulated_glIsVertexArray;
 
 // -----------------------------------------------------------------------------
 
@@ -82,13 +212,15 @@ static void init_functions()
                 (my__glBindVertexArray    == nullptr) ||
                 (my__glIsVertexArray      == nullptr) )
             {
-                // Restore 'dummy' version
-                my__glGenVertexArrays    = dummy_glGenVertexArrays;
-                my__glDeleteVertexArrays = dummy_glDeleteVertexArrays;
-                my__glBindVertexArray    = dummy_glBindVertexArray;
-                my__glIsVertexArray      = dummy_glIsVertexArray;
+                // Fallback to software emulation
+                my__glGenVertexArrays    = emulated_glGenVertexArrays;
+                my__glDeleteVertexArrays = emulated_glDeleteVertexArrays;
+                my__glBindVertexArray    = emulated_glBindVertexArray;
+                my__glIsVertexArray      = emulated_glIsVertexArray;
 
-                fprintf(stderr, "[GLWRAP] VertexArrayObject function pointers invalid!\n");
+                IS_EMULATED = true;
+
+                fprintf(stderr, "[GLWRAP] VertexArrayObject function pointers invalid, using software emulation\n");
                 fflush(stderr);
             }
         }
@@ -107,31 +239,554 @@ static void init_functions()
 
 // -----------------------------------------------------------------------------
 
+/*
+    CPU-side tracking of VAO binding, to skip redundant glBindVertexArray()
+    and glGetIntegerv() round-trips.
+
+    GL context is current in single thread at a time, so tracker is
+    thread-local (one per context, while each context is used from own
+    thread). After switching contexts on same thread, or binding VAOs outside
+    of gl::VertexArrayObject, call VertexArrayObject::invalidateBindingCache().
+*/
+struct BindingTracker
+{
+    gl::Object::id_t binded_id;
+    bool             is_known;          // false - 'binded_id' must be queried
+    bool             is_unbind_pending; // unbind() called, but not applied yet
+};
+
+static thread_local BindingTracker BINDING_TRACKER = { 0, false, false };
+
+static void tracked_bind(gl::Object::id_t id)
+{
+    BINDING_TRACKER.is_unbind_pending = false;
+
+    if(BINDING_TRACKER.is_known && (BINDING_TRACKER.binded_id == id))
+    {
+        return;
+    }
+
+    GLWRAP_GL_CHECK( my__glBindVertexArray(id) );
+
+    BINDING_TRACKER.binded_id = id;
+    BINDING_TRACKER.is_known  = true;
+}
+
+// -----------------------------------------------------------------------------
+
+static void gen_vertex_arrays(int n, gl::Object::id_t* ids)
+{
+    init_functions();
+
+    GLWRAP_GL_CHECK( my__glGenVertexArrays(n, ids) );
+}
+
+static void delete_vertex_arrays(int n, const gl::Object::id_t* ids)
+{
+    GLWRAP_GL_CHECK( my__glDeleteVertexArrays(n, ids) );
+}
+
+template <>
+gl::NamePool& gl::get_name_pool<gl::VertexArrayObject>()
+{
+    static NamePool pool(gen_vertex_arrays, delete_vertex_arrays);
+    return pool;
+}
+
+// -----------------------------------------------------------------------------
+
 gl::VertexArrayObject::VertexArrayObject()
     : Object()
+    , _enabled_locations_mask(0)
+    , _is_format_applied(false)
 {
     init_functions();
 
-    GLWRAP_GL_CHECK( my__glGenVertexArrays(1, &_id) );
+    _id = get_name_pool<VertexArrayObject>().acquire();
 }
 
 gl::VertexArrayObject::~VertexArrayObject()
 {
     GLWRAP_GL_CHECK( my__glDeleteVertexArrays(1, &_id) );
+
+    // Deleting of binded VAO reverts binding to 0
+    if(BINDING_TRACKER.is_known && (BINDING_TRACKER.binded_id == _id))
+    {
+        BINDING_TRACKER.binded_id         = 0;
+        BINDING_TRACKER.is_unbind_pending = false;
+    }
 }
 
 // -----------------------------------------------------------------------------
 
 void gl::VertexArrayObject::bind()
 {
-    GLWRAP_GL_CHECK( my__glBindVertexArray(_id) );
+    tracked_bind(_id);
 }
 
 void gl::VertexArrayObject::unbind()
 {
     init_functions();
 
-    GLWRAP_GL_CHECK( my__glBindVertexArray(0) );
+    if(BINDING_TRACKER.is_known && (BINDING_TRACKER.binded_id == 0))
+    {
+        return;
+    }
+
+    // Lazy: real glBindVertexArray(0) is done only if next bind() not
+    // follows, and something needs binding 0 (see applyPendingUnbind())
+    BINDING_TRACKER.is_unbind_pending = true;
+}
+
+void gl::VertexArrayObject::applyPendingUnbind()
+{
+    if(BINDING_TRACKER.is_unbind_pending)
+    {
+        init_functions();
+
+        tracked_bind(0);
+    }
+}
+
+void gl::VertexArrayObject::bindElementBuffer(gl::Object::id_t id)
+{
+    init_functions();
+
+    applyPendingUnbind();
+
+    GLWRAP_GL_CHECK( glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id) );
+
+    if(IS_EMULATED)
+    {
+        EMULATED_APPLIED_STATE.element_buffer              = id;
+        EMULATED_ARRAYS[EMULATED_BINDED_ID].element_buffer = id;
+    }
+}
+
+void gl::VertexArrayObject::invalidateBindingCache()
+{
+    BINDING_TRACKER.is_known          = false;
+    BINDING_TRACKER.is_unbind_pending = false;
+}
+
+// -----------------------------------------------------------------------------
+
+/// Enables/disables arrays by difference of masks only
+static void update_enabled_arrays(uint32_t old_mask, uint32_t new_mask)
+{
+    for(unsigned int location = 0; location < 32; ++location)
+    {
+        const uint32_t bit = (1u << location);
+
+        if((new_mask & bit) && !(old_mask & bit))
+        {
+            GLWRAP_GL_CHECK( glEnableVertexAttribArray(location) );
+        }
+        else if(!(new_mask & bit) && (old_mask & bit))
+        {
+            GLWRAP_GL_CHECK( glDisableVertexAttribArray(location) );
+        }
+    }
+}
+
+void gl::VertexArrayObject::apply(const gl::VertexLayout& layout, gl::Buffer* const* buffers, size_t buffers_count)
+{
+    assert(buffers_count >= layout.getBuffersCount());
+
+    bind();
+
+    // Same layout & buffers - nothing to do
+    if((layout == _applied_layout) &&
+       (_applied_buffers.size() == buffers_count) &&
+       std::equal(_applied_buffers.begin(), _applied_buffers.end(), buffers,
+                  [](id_t id, const Buffer* buffer) { return id == buffer->getId(); }))
+    {
+        return;
+    }
+
+    const std::vector<VertexAttribute>& old_attributes = _applied_layout.getAttributes();
+
+    auto find_old_attribute = [&old_attributes](unsigned int location) -> const VertexAttribute* {
+        for(const VertexAttribute& attribute : old_attributes)
+        {
+            if(attribute.location == location)
+            {
+                return &attribute;
+            }
+        }
+        return nullptr;
+    };
+
+    uint32_t new_enabled_mask = 0;
+    id_t     current_array_buffer = 0;
+    bool     is_array_buffer_set  = false;
+
+    // After applyFormat() divisors were set per binding (buffer index), and
+    // glVertexAttribPointer() doesn't reset divisor of binding it switches
+    // to - so they are unknown
+    const bool is_divisors_unknown = _is_format_applied;
+
+    for(const VertexAttribute& attribute : layout.getAttributes())
+    {
+        assert(attribute.location < 32);
+        new_enabled_mask |= (1u << attribute.location);
+
+        const id_t         buffer_id = buffers[attribute.buffer_index]->getId();
+        const unsigned int stride    = layout.getStride(attribute.buffer_index);
+
+        const VertexAttribute* old_attribute = find_old_attribute(attribute.location);
+
+        const bool is_pointer_same =
+                (old_attribute != nullptr) &&
+                (old_attribute->components == attribute.components) &&
+                (old_attribute->type       == attribute.type)       &&
+                (old_attribute->normalized == attribute.normalized) &&
+                (old_attribute->is_integer == attribute.is_integer) &&
+                (old_attribute->offset     == attribute.offset)     &&
+                (old_attribute->buffer_index < _applied_buffers.size()) &&
+                (_applied_buffers[old_attribute->buffer_index] == buffer_id) &&
+                (_applied_layout.getStride(old_attribute->buffer_index) == stride);
+
+        if(!is_pointer_same)
+        {
+            if(!is_array_buffer_set || (current_array_buffer != buffer_id))
+            {
+                Buffer::setBindedId(GL_ARRAY_BUFFER, buffer_id);
+                current_array_buffer = buffer_id;
+                is_array_buffer_set  = true;
+            }
+
+            const void* pointer = reinterpret_cast<const void*>(static_cast<size_t>(attribute.offset));
+
+            if(attribute.is_integer)
+            {
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 0) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+                GLWRAP_GL_CHECK( glVertexAttribIPointer(attribute.location, attribute.components, attribute.type, stride, pointer) );
+#else
+                fprintf(stderr, "[GLWRAP] :: glVertexAttribIPointer(%u, ...) not supported!\n", attribute.location);
+#endif
+            }
+            else
+            {
+                GLWRAP_GL_CHECK( glVertexAttribPointer(attribute.location, attribute.components, attribute.type,
+                                                       attribute.normalized ? GL_TRUE : GL_FALSE, stride, pointer) );
+            }
+        }
+
+        const unsigned int old_divisor = (old_attribute != nullptr) ? old_attribute->divisor : 0;
+
+        if(is_divisors_unknown || (attribute.divisor != old_divisor))
+        {
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 3) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+            GLWRAP_GL_CHECK( glVertexAttribDivisor(attribute.location, attribute.divisor) );
+#else
+            fprintf(stderr, "[GLWRAP] :: glVertexAttribDivisor(%u, %u) not supported!\n", attribute.location, attribute.divisor);
+#endif
+        }
+    }
+
+    update_enabled_arrays(_enabled_locations_mask, new_enabled_mask);
+
+    // Divisor of disabled attribute is kept by GL - reset it, so next apply()
+    // starts from known state
+    for(const VertexAttribute& old_attribute : old_attributes)
+    {
+        if(!(new_enabled_mask & (1u << old_attribute.location)) && (old_attribute.divisor != 0))
+        {
+#if (GLWRAP_GL_FROM_OPENGL_VER(3, 3) || GLWRAP_GL_FROM_GLES_VER(3, 0))
+            GLWRAP_GL_CHECK( glVertexAttribDivisor(old_attribute.location, 0) );
+#endif
+        }
+    }
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+    // Same for instanced bindings of format path, not used as locations now
+    if(is_divisors_unknown)
+    {
+        uint32_t reset_mask = new_enabled_mask;
+
+        for(const VertexAttribute& format_attribute : _format_layout.getAttributes())
+        {
+            const unsigned int binding = format_attribute.buffer_index;
+            assert(binding < 32);
+
+            if((format_attribute.divisor != 0) && !(reset_mask & (1u << binding)))
+            {
+                GLWRAP_GL_CHECK( glVertexAttribDivisor(binding, 0) );
+                reset_mask |= (1u << binding);
+            }
+        }
+    }
+#endif
+
+    if(IS_EMULATED)
+    {
+        for(const VertexAttribute& attribute : layout.getAttributes())
+        {
+            EmulatedAttribute recorded;
+            recorded.enabled    = true;
+            recorded.buffer     = buffers[attribute.buffer_index]->getId();
+            recorded.components = attribute.components;
+            recorded.type       = static_cast<GLenum>(attribute.type);
+            recorded.normalized = attribute.normalized ? GL_TRUE : GL_FALSE;
+            recorded.stride     = static_cast<GLsizei>(layout.getStride(attribute.buffer_index));
+            recorded.pointer    = reinterpret_cast<const void*>(static_cast<size_t>(attribute.offset));
+
+            emulated_record_attribute(attribute.location, recorded);
+        }
+
+        for(const VertexAttribute& old_attribute : old_attributes)
+        {
+            if(!(new_enabled_mask & (1u << old_attribute.location)))
+            {
+                emulated_record_attribute_enabled(old_attribute.location, false);
+            }
+        }
+    }
+
+    _applied_layout         = layout;
+    _enabled_locations_mask = new_enabled_mask;
+
+    // glVertexAttribPointer() overwrites separate format & binding state
+    _is_format_applied = false;
+    _binded_vertex_buffers.clear();
+
+    _applied_buffers.resize(buffers_count);
+    for(size_t i = 0; i < buffers_count; ++i)
+    {
+        _applied_buffers[i] = buffers[i]->getId();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::VertexArrayObject::applyFormat(const gl::VertexLayout& layout)
+{
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+    bind();
+
+    if(_is_format_applied && (layout == _format_layout))
+    {
+        return;
+    }
+
+    const std::vector<VertexAttribute>& old_attributes = _format_layout.getAttributes();
+
+    auto find_old_attribute = [&](unsigned int location) -> const VertexAttribute* {
+        if(!_is_format_applied)
+        {
+            return nullptr;
+        }
+        for(const VertexAttribute& attribute : old_attributes)
+        {
+            if(attribute.location == location)
+            {
+                return &attribute;
+            }
+        }
+        return nullptr;
+    };
+
+    uint32_t new_enabled_mask = 0;
+
+    for(const VertexAttribute& attribute : layout.getAttributes())
+    {
+        assert(attribute.location < 32);
+        new_enabled_mask |= (1u << attribute.location);
+
+        const VertexAttribute* old_attribute = find_old_attribute(attribute.location);
+
+        if((old_attribute == nullptr) ||
+           (old_attribute->components != attribute.components) ||
+           (old_attribute->type       != attribute.type)       ||
+           (old_attribute->normalized != attribute.normalized) ||
+           (old_attribute->is_integer != attribute.is_integer) ||
+           (old_attribute->offset     != attribute.offset))
+        {
+            if(attribute.is_integer)
+            {
+                GLWRAP_GL_CHECK( glVertexAttribIFormat(attribute.location, attribute.components, attribute.type, attribute.offset) );
+            }
+            else
+            {
+                GLWRAP_GL_CHECK( glVertexAttribFormat(attribute.location, attribute.components, attribute.type,
+                                                      attribute.normalized ? GL_TRUE : GL_FALSE, attribute.offset) );
+            }
+        }
+
+        if((old_attribute == nullptr) || (old_attribute->buffer_index != attribute.buffer_index))
+        {
+            GLWRAP_GL_CHECK( glVertexAttribBinding(attribute.location, attribute.buffer_index) );
+        }
+    }
+
+    // Divisor is per binding (buffer), not per attribute
+    for(unsigned int buffer_index = 0; buffer_index < layout.getBuffersCount(); ++buffer_index)
+    {
+        unsigned int divisor     = 0;
+        unsigned int old_divisor = 0;
+
+        for(const VertexAttribute& attribute : layout.getAttributes())
+        {
+            if(attribute.buffer_index == buffer_index) { divisor = attribute.divisor; }
+        }
+        for(const VertexAttribute& attribute : old_attributes)
+        {
+            if(attribute.buffer_index == buffer_index) { old_divisor = attribute.divisor; }
+        }
+
+        if(!_is_format_applied || (divisor != old_divisor))
+        {
+            GLWRAP_GL_CHECK( glVertexBindingDivisor(buffer_index, divisor) );
+        }
+    }
+
+    update_enabled_arrays(_enabled_locations_mask, new_enabled_mask);
+
+    _enabled_locations_mask = new_enabled_mask;
+    _is_format_applied      = true;
+
+    // Pointer path state is overwritten
+    _applied_layout = VertexLayout();
+    _applied_buffers.clear();
+#endif
+
+    _format_layout = layout;
+}
+
+/// Bytes, taken by attribute in vertex
+static unsigned int get_attribute_size(const gl::VertexAttribute& attribute)
+{
+    unsigned int component_size = 4;
+
+    switch (attribute.type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        component_size = 1;
+        break;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+#if defined(GL_HALF_FLOAT)
+    case GL_HALF_FLOAT:
+#endif
+        component_size = 2;
+        break;
+#if defined(GL_INT_2_10_10_10_REV)
+    case GL_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+        return 4; // All components
+#endif
+#if defined(GL_DOUBLE)
+    case GL_DOUBLE:
+        component_size = 8;
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return component_size * static_cast<unsigned int>(attribute.components);
+}
+
+/// Stride of 0 in layout means tightly packed, but for glBindVertexBuffer()
+/// it means, that all vertices read the first one - so packed stride (end of
+/// the last attribute of buffer) is computed for it
+static unsigned int get_binding_stride(const gl::VertexLayout& layout, unsigned int buffer_index)
+{
+    const unsigned int stride = layout.getStride(buffer_index);
+
+    if(stride != 0)
+    {
+        return stride;
+    }
+
+    unsigned int packed_stride = 0;
+
+    for(const gl::VertexAttribute& attribute : layout.getAttributes())
+    {
+        if(attribute.buffer_index == buffer_index)
+        {
+            packed_stride = std::max(packed_stride, attribute.offset + get_attribute_size(attribute));
+        }
+    }
+
+    return packed_stride;
+}
+
+void gl::VertexArrayObject::bindVertexBuffers(gl::Buffer* const* buffers, size_t buffers_count, const long* offsets)
+{
+    assert(buffers_count >= _format_layout.getBuffersCount());
+
+#if (GLWRAP_GL_FROM_OPENGL_VER(4, 3) || GLWRAP_GL_FROM_GLES_VER(3, 1))
+    bind();
+
+    std::vector<BindedVertexBuffer> new_binded(buffers_count);
+
+    for(size_t i = 0; i < buffers_count; ++i)
+    {
+        new_binded[i].id     = buffers[i]->getId();
+        new_binded[i].offset = (offsets != nullptr) ? offsets[i] : 0;
+        new_binded[i].stride = get_binding_stride(_format_layout, static_cast<unsigned int>(i));
+    }
+
+    if(new_binded == _binded_vertex_buffers)
+    {
+        return;
+    }
+
+    #if GLWRAP_GL_FROM_OPENGL_VER(4, 4)
+    {
+        std::vector<GLuint>   ids(buffers_count);
+        std::vector<GLintptr> gl_offsets(buffers_count);
+        std::vector<GLsizei>  strides(buffers_count);
+
+        for(size_t i = 0; i < buffers_count; ++i)
+        {
+            ids[i]        = new_binded[i].id;
+            gl_offsets[i] = new_binded[i].offset;
+            strides[i]    = static_cast<GLsizei>(new_binded[i].stride);
+        }
+
+        // All buffers by single call
+        GLWRAP_GL_CHECK( glBindVertexBuffers(0, static_cast<GLsizei>(buffers_count), ids.data(), gl_offsets.data(), strides.data()) );
+    }
+    #else
+    {
+        for(size_t i = 0; i < buffers_count; ++i)
+        {
+            if((i < _binded_vertex_buffers.size()) && (_binded_vertex_buffers[i] == new_binded[i]))
+            {
+                continue;
+            }
+
+            GLWRAP_GL_CHECK( glBindVertexBuffer(static_cast<GLuint>(i), new_binded[i].id, new_binded[i].offset, static_cast<GLsizei>(new_binded[i].stride)) );
+        }
+    }
+    #endif
+
+    _binded_vertex_buffers.swap(new_binded);
+#else
+    // Fallback: pointer path, with offsets folded into attributes offsets
+    VertexLayout layout;
+
+    for(unsigned int i = 0; i < _format_layout.getBuffersCount(); ++i)
+    {
+        // Stride of whole vertex - for 0 glVertexAttribPointer() would take
+        // size of each attribute
+        layout.setStride(i, get_binding_stride(_format_layout, i));
+    }
+
+    for(VertexAttribute attribute : _format_layout.getAttributes())
+    {
+        if(offsets != nullptr)
+        {
+            attribute.offset += static_cast<unsigned int>(offsets[attribute.buffer_index]);
+        }
+        layout.add(attribute);
+    }
+
+    apply(layout, buffers, buffers_count);
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -151,9 +806,25 @@ gl::VertexArrayObject::id_t gl::VertexArrayObject::getBindedId()
     // so we need to try initialize related functions for it.
     init_functions();
 
-    int current_vao;
-    GLWRAP_GL_CHECK( glGetIntegerv(MY_GL_VERTEX_ARRAY_BINDING, &current_vao) );
-    return static_cast<id_t>(current_vao);
+    // Query GL only once (until invalidateBindingCache())
+    if(BINDING_TRACKER.is_known == false)
+    {
+        if(IS_EMULATED)
+        {
+            BINDING_TRACKER.binded_id = EMULATED_BINDED_ID;
+            BINDING_TRACKER.is_known  = true;
+
+            return BINDING_TRACKER.is_unbind_pending ? 0 : BINDING_TRACKER.binded_id;
+        }
+
+        int current_vao;
+        GLWRAP_GL_CHECK( glGetIntegerv(MY_GL_VERTEX_ARRAY_BINDING, &current_vao) );
+
+        BINDING_TRACKER.binded_id = static_cast<id_t>(current_vao);
+        BINDING_TRACKER.is_known  = true;
+    }
+
+    return BINDING_TRACKER.is_unbind_pending ? 0 : BINDING_TRACKER.binded_id;
 }
 
 void gl::VertexArrayObject::setBindedId(gl::Object::id_t id)
@@ -162,7 +833,7 @@ void gl::VertexArrayObject::setBindedId(gl::Object::id_t id)
     // so we need to try initialize related functions for it.
     init_functions();
 
-    GLWRAP_GL_CHECK( my__glBindVertexArray(id) );
+    tracked_bind(id);
 }
 
 bool gl::VertexArrayObject::isBinded() const
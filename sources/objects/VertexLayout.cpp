@@ -0,0 +1,158 @@
+#include <gl_wrap/objects/VertexLayout.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+// -----------------------------------------------------------------------------
+// Compile-time tests (hidden here, to execute them once, not on each include)
+
+static_assert(gl::vertex_component_traits<int8_t  >::type == GL_BYTE,           "Test failed");
+static_assert(gl::vertex_component_traits<uint8_t >::type == GL_UNSIGNED_BYTE,  "Test failed");
+static_assert(gl::vertex_component_traits<int16_t >::type == GL_SHORT,          "Test failed");
+static_assert(gl::vertex_component_traits<uint16_t>::type == GL_UNSIGNED_SHORT, "Test failed");
+static_assert(gl::vertex_component_traits<int32_t >::type == GL_INT,            "Test failed");
+static_assert(gl::vertex_component_traits<uint32_t>::type == GL_UNSIGNED_INT,   "Test failed");
+static_assert(gl::vertex_component_traits<float   >::type == GL_FLOAT,          "Test failed");
+
+namespace {
+
+struct TestVertex
+{
+    float     position[3];
+    uint8_t   color[4];
+    gl::ColorRGBA tint;
+};
+
+constexpr gl::VertexAttribute TEST_COLOR = GLWRAP_VERTEX_ATTRIBUTE_NORMALIZED(TestVertex, color, 1);
+
+static_assert(TEST_COLOR.components == 4 && TEST_COLOR.type == GL_UNSIGNED_BYTE, "Test failed");
+static_assert(TEST_COLOR.offset == 12 && TEST_COLOR.normalized, "Test failed");
+
+struct TestInstance
+{
+    float    transform[4][4];
+    gl::Rect sub_rect;
+};
+
+constexpr gl::VertexAttribute TEST_COLUMN = gl::make_matrix_column_attribute<decltype(TestInstance::transform)>(2, 0, 3);
+
+static_assert(TEST_COLUMN.location == 5 && TEST_COLUMN.offset == 48 && TEST_COLUMN.components == 4, "Test failed");
+
+constexpr gl::VertexAttribute TEST_SUB_RECT = GLWRAP_VERTEX_ATTRIBUTE_INTEGER(TestInstance, sub_rect, 6);
+
+static_assert(TEST_SUB_RECT.type == GL_INT && TEST_SUB_RECT.is_integer && !TEST_SUB_RECT.normalized, "Test failed");
+static_assert(TEST_SUB_RECT != GLWRAP_VERTEX_ATTRIBUTE(TestInstance, sub_rect, 6), "Test failed");
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+
+gl::VertexLayout::VertexLayout()
+    : _hash(0)
+{
+    updateHash();
+}
+
+// -----------------------------------------------------------------------------
+
+gl::VertexLayout& gl::VertexLayout::add(const gl::VertexAttribute& attribute)
+{
+    _attributes.push_back(attribute);
+
+    if(attribute.buffer_index >= _strides.size())
+    {
+        _strides.resize(attribute.buffer_index + 1, 0);
+    }
+
+    updateHash();
+    return *this;
+}
+
+gl::VertexLayout& gl::VertexLayout::add(unsigned int location, const gl::VertexAttributeFormat& format,
+                                        unsigned int offset, unsigned int buffer_index, unsigned int divisor)
+{
+    return add(VertexAttribute(location, format.components, format.type, format.normalized,
+                               offset, buffer_index, divisor));
+}
+
+gl::VertexLayout& gl::VertexLayout::setStride(unsigned int buffer_index, unsigned int stride)
+{
+    if(buffer_index >= _strides.size())
+    {
+        _strides.resize(buffer_index + 1, 0);
+    }
+
+    _strides[buffer_index] = stride;
+
+    updateHash();
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+const std::vector<gl::VertexAttribute>& gl::VertexLayout::getAttributes() const
+{
+    return _attributes;
+}
+
+unsigned int gl::VertexLayout::getStride(unsigned int buffer_index) const
+{
+    return (buffer_index < _strides.size()) ? _strides[buffer_index] : 0;
+}
+
+size_t gl::VertexLayout::getBuffersCount() const
+{
+    return _strides.size();
+}
+
+size_t gl::VertexLayout::getHash() const
+{
+    return _hash;
+}
+
+// -----------------------------------------------------------------------------
+
+bool gl::VertexLayout::operator == (const gl::VertexLayout& other) const
+{
+    return
+            (_hash       == other._hash)       &&
+            (_attributes == other._attributes) &&
+            (_strides    == other._strides);
+}
+
+bool gl::VertexLayout::operator != (const gl::VertexLayout& other) const
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::VertexLayout::updateHash()
+{
+    // FNV-1a, over fields (not raw bytes - to not depend on padding)
+    uint64_t hash = 14695981039346656037ull;
+
+    auto mix = [&hash](uint32_t value) {
+        hash = (hash ^ value) * 1099511628211ull;
+    };
+
+    for(const VertexAttribute& attribute : _attributes)
+    {
+        mix(attribute.location);
+        mix(static_cast<uint32_t>(attribute.components));
+        mix(static_cast<uint32_t>(attribute.type));
+        mix(attribute.normalized ? 1u : 0u);
+        mix(attribute.offset);
+        mix(attribute.buffer_index);
+        mix(attribute.divisor);
+        mix(attribute.is_integer ? 1u : 0u);
+    }
+
+    mix(0xFFFFFFFFu); // Separator
+
+    for(const unsigned int stride : _strides)
+    {
+        mix(stride);
+    }
+
+    _hash = static_cast<size_t>(hash);
+}
@@ -166,6 +166,59 @@ bool gl::make_program(
                         &fragmentShaderSource, 1);
 }
 
+bool gl::make_program_cached(
+        gl::ProgramBinaryCache &cache,
+        const char *name,
+        gl::ShaderProgram &program,
+        const char **vertexShaderSource, int vertexShaderSourceCount,
+        const char **fragmentShaderSource, int fragmentShaderSourceCount)
+{
+    const uint64_t key = cache.makeKey(vertexShaderSource,   vertexShaderSourceCount,
+                                       fragmentShaderSource, fragmentShaderSourceCount);
+
+    if(cache.load(key, program))
+    {
+        program.validate();
+        if(!program.isValid())
+        {
+            fprintf(stderr, "[GLWRAP] %s %i: (%s) Program valdation error:\n%s\n", __FILE__, __LINE__, name, program.getInfoLog().c_str());
+            fflush(stderr);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    // Miss or rejected binary - fallback to sources
+    program.setBinaryRetrievableHint(true);
+
+    if(!make_program(name,
+                     program,
+                     vertexShaderSource,   vertexShaderSourceCount,
+                     fragmentShaderSource, fragmentShaderSourceCount))
+    {
+        return false;
+    }
+
+    cache.store(key, program);
+    return true;
+}
+
+bool gl::make_program_cached(
+        gl::ProgramBinaryCache &cache,
+        const char *name,
+        gl::ShaderProgram &program,
+        const char *vertexShaderSource,
+        const char *fragmentShaderSource)
+{
+    return make_program_cached(cache,
+                               name,
+                               program,
+                               &vertexShaderSource,   1,
+                               &fragmentShaderSource, 1);
+}
+
 // -----------------------------------------------------------------------------
 
 /*
@@ -342,3 +395,36 @@ bool gl::make_program_compat(
                         Compat_VertexShaderSource,   5,
                         Compat_FragmentShaderSource, 5);
 }
+
+bool gl::make_program_compat_cached(
+        gl::ProgramBinaryCache &cache,
+        const char *name,
+        gl::ShaderProgram &program,
+        const char *vertexShaderSource,
+        const char *fragmentShaderSource)
+{
+    // Preamble & version string are part of sources - so part of cache key
+    const char* Compat_VertexShaderSource[5]
+    {
+        "#version ", gl::glsl_version_str(), "\n",
+
+        COMPATIBILITY_DEFINES,
+
+        vertexShaderSource
+    };
+
+    const char* Compat_FragmentShaderSource[5]
+    {
+        "#version ", gl::glsl_version_str(), "\n",
+
+        COMPATIBILITY_DEFINES,
+
+        fragmentShaderSource
+    };
+
+    return make_program_cached(cache,
+                               name,
+                               program,
+                               Compat_VertexShaderSource,   5,
+                               Compat_FragmentShaderSource, 5);
+}
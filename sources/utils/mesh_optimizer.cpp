@@ -0,0 +1,472 @@
+#include <gl_wrap/utils/mesh_optimizer.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+#include <algorithm> // for std::stable_sort()
+#include <cassert>   // for assert()
+#include <cmath>     // for std::sqrt()
+#include <cstring>   // for memcpy()
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/// Triangles, adjacent to each vertex (CSR-like: offsets + flat list)
+struct VertexAdjacency
+{
+    std::vector<uint32_t> offsets;   // vertex_count + 1
+    std::vector<uint32_t> triangles; // index_count
+
+    VertexAdjacency(const uint32_t* indices, size_t index_count, size_t vertex_count)
+        : offsets(vertex_count + 1, 0)
+        , triangles(index_count)
+    {
+        for(size_t i = 0; i < index_count; ++i)
+        {
+            ++offsets[indices[i] + 1];
+        }
+
+        for(size_t v = 0; v < vertex_count; ++v)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+        for(size_t i = 0; i < index_count; ++i)
+        {
+            triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+};
+
+/// FIFO cache simulation
+class VertexCacheFIFO
+{
+    std::vector<uint32_t> _timestamps; // Time of insertion into cache, per vertex
+    uint32_t _time;
+    uint32_t _cache_size;
+
+public:
+
+    VertexCacheFIFO(size_t vertex_count, size_t cache_size)
+        : _timestamps(vertex_count, 0)
+        , _time(static_cast<uint32_t>(cache_size) + 1)
+        , _cache_size(static_cast<uint32_t>(cache_size))
+    {}
+
+    /// Returns true on cache miss
+    inline bool access(uint32_t vertex)
+    {
+        if(_time - _timestamps[vertex] > _cache_size)
+        {
+            _timestamps[vertex] = _time++;
+            return true;
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+
+gl::VertexCacheStats gl::analyze_vertex_cache(const uint32_t* indices, size_t index_count,
+                                              size_t vertex_count, size_t cache_size)
+{
+    VertexCacheFIFO cache(vertex_count, cache_size);
+
+    std::vector<bool> used(vertex_count, false);
+    size_t unique_count = 0;
+
+    VertexCacheStats result;
+    result.vertices_transformed = 0;
+
+    for(size_t i = 0; i < index_count; ++i)
+    {
+        const uint32_t vertex = indices[i];
+
+        if(cache.access(vertex))
+        {
+            ++result.vertices_transformed;
+        }
+
+        if(!used[vertex])
+        {
+            used[vertex] = true;
+            ++unique_count;
+        }
+    }
+
+    const size_t triangles_count = index_count / 3;
+
+    result.acmr = (triangles_count > 0) ? static_cast<float>(result.vertices_transformed) / triangles_count : 0.0f;
+    result.atvr = (unique_count    > 0) ? static_cast<float>(result.vertices_transformed) / unique_count    : 0.0f;
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::optimize_vertex_cache(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                               size_t vertex_count, size_t cache_size)
+{
+    assert((index_count == 0) || (destination != indices)); // Both nullptr for empty mesh
+    assert(index_count % 3 == 0);
+
+    if(index_count == 0)
+    {
+        return;
+    }
+
+    const VertexAdjacency adjacency(indices, index_count, vertex_count);
+
+    // Count of not emitted triangles, per vertex
+    std::vector<uint32_t> live_triangles(vertex_count);
+    for(size_t v = 0; v < vertex_count; ++v)
+    {
+        live_triangles[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+
+    std::vector<uint32_t> cache_timestamps(vertex_count, 0);
+    uint32_t time = static_cast<uint32_t>(cache_size) + 1;
+
+    std::vector<bool>     emitted(index_count / 3, false);
+    std::vector<uint32_t> dead_end_stack;
+    std::vector<uint32_t> candidates;
+
+    size_t output_count = 0;
+    size_t scan_cursor  = 0; // For search of next vertex with live triangles
+
+    // Start from first used vertex
+    long fanning_vertex = -1;
+    while(scan_cursor < vertex_count)
+    {
+        if(live_triangles[scan_cursor++] > 0)
+        {
+            fanning_vertex = static_cast<long>(scan_cursor - 1);
+            break;
+        }
+    }
+
+    while(fanning_vertex >= 0)
+    {
+        candidates.clear();
+
+        // Emit all remaining triangles of fanning vertex
+        for(uint32_t k = adjacency.offsets[fanning_vertex]; k < adjacency.offsets[fanning_vertex + 1]; ++k)
+        {
+            const uint32_t triangle = adjacency.triangles[k];
+
+            if(emitted[triangle])
+            {
+                continue;
+            }
+
+            for(int corner = 0; corner < 3; ++corner)
+            {
+                const uint32_t vertex = indices[triangle * 3 + corner];
+
+                destination[output_count++] = vertex;
+
+                dead_end_stack.push_back(vertex);
+                candidates.push_back(vertex);
+
+                --live_triangles[vertex];
+
+                if(time - cache_timestamps[vertex] > cache_size)
+                {
+                    cache_timestamps[vertex] = time++;
+                }
+            }
+
+            emitted[triangle] = true;
+        }
+
+        // Pick next fanning vertex: the one, which stays longest in cache
+        // after emitting all its triangles
+        fanning_vertex = -1;
+        int best_priority = -1;
+
+        for(const uint32_t vertex : candidates)
+        {
+            if(live_triangles[vertex] == 0)
+            {
+                continue;
+            }
+
+            int priority = 0;
+
+            if(time - cache_timestamps[vertex] + 2 * live_triangles[vertex] <= cache_size)
+            {
+                priority = static_cast<int>(time - cache_timestamps[vertex]);
+            }
+
+            if(priority > best_priority)
+            {
+                best_priority  = priority;
+                fanning_vertex = vertex;
+            }
+        }
+
+        if(fanning_vertex >= 0)
+        {
+            continue;
+        }
+
+        // Dead end: recently used vertex with live triangles
+        while(!dead_end_stack.empty())
+        {
+            const uint32_t vertex = dead_end_stack.back();
+            dead_end_stack.pop_back();
+
+            if(live_triangles[vertex] > 0)
+            {
+                fanning_vertex = vertex;
+                break;
+            }
+        }
+
+        // ... or next vertex with live triangles in input order
+        while(fanning_vertex < 0 && scan_cursor < vertex_count)
+        {
+            if(live_triangles[scan_cursor++] > 0)
+            {
+                fanning_vertex = static_cast<long>(scan_cursor - 1);
+            }
+        }
+    }
+
+    assert(output_count == index_count);
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::optimize_overdraw(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                           const float* positions, size_t positions_stride,
+                           size_t vertex_count, size_t cache_size)
+{
+    assert((index_count == 0) || (destination != indices)); // Both nullptr for empty mesh
+    assert(index_count % 3 == 0);
+
+    const size_t triangles_count = index_count / 3;
+
+    if(triangles_count == 0)
+    {
+        return;
+    }
+
+    const unsigned char* positions_bytes = reinterpret_cast<const unsigned char*>(positions);
+
+    auto position_of = [&](uint32_t vertex) -> const float* {
+        return reinterpret_cast<const float*>(positions_bytes + vertex * positions_stride);
+    };
+
+    // Split into clusters: new cluster starts at triangle, where all 3
+    // vertices miss the cache (cache restart - reordering there is free)
+    std::vector<size_t> cluster_starts;
+    {
+        VertexCacheFIFO cache(vertex_count, cache_size);
+
+        for(size_t t = 0; t < triangles_count; ++t)
+        {
+            int misses = 0;
+            for(int corner = 0; corner < 3; ++corner)
+            {
+                misses += cache.access(indices[t * 3 + corner]) ? 1 : 0;
+            }
+
+            if(misses == 3 || t == 0)
+            {
+                cluster_starts.push_back(t);
+            }
+        }
+    }
+
+    const size_t clusters_count = cluster_starts.size();
+    cluster_starts.push_back(triangles_count);
+
+    // Mesh centroid (over all triangles)
+    double mesh_centroid[3] = { 0.0, 0.0, 0.0 };
+    for(size_t i = 0; i < index_count; ++i)
+    {
+        const float* p = position_of(indices[i]);
+        mesh_centroid[0] += p[0];
+        mesh_centroid[1] += p[1];
+        mesh_centroid[2] += p[2];
+    }
+    for(double& c : mesh_centroid)
+    {
+        c /= static_cast<double>(index_count);
+    }
+
+    // Sort key per cluster: how much cluster faces outward
+    std::vector<float> sort_keys(clusters_count);
+
+    for(size_t c = 0; c < clusters_count; ++c)
+    {
+        double centroid[3] = { 0.0, 0.0, 0.0 };
+        double normal[3]   = { 0.0, 0.0, 0.0 };
+
+        for(size_t t = cluster_starts[c]; t < cluster_starts[c + 1]; ++t)
+        {
+            const float* p0 = position_of(indices[t * 3 + 0]);
+            const float* p1 = position_of(indices[t * 3 + 1]);
+            const float* p2 = position_of(indices[t * 3 + 2]);
+
+            const double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+
+            // Area-weighted normal
+            normal[0] += e1[1] * e2[2] - e1[2] * e2[1];
+            normal[1] += e1[2] * e2[0] - e1[0] * e2[2];
+            normal[2] += e1[0] * e2[1] - e1[1] * e2[0];
+
+            for(int axis = 0; axis < 3; ++axis)
+            {
+                centroid[axis] += (p0[axis] + p1[axis] + p2[axis]) / 3.0;
+            }
+        }
+
+        const double cluster_triangles = static_cast<double>(cluster_starts[c + 1] - cluster_starts[c]);
+        const double normal_length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+        double key = 0.0;
+
+        if(normal_length > 0.0)
+        {
+            for(int axis = 0; axis < 3; ++axis)
+            {
+                key += (centroid[axis] / cluster_triangles - mesh_centroid[axis]) * (normal[axis] / normal_length);
+            }
+        }
+
+        sort_keys[c] = static_cast<float>(key);
+    }
+
+    std::vector<size_t> clusters_order(clusters_count);
+    for(size_t c = 0; c < clusters_count; ++c)
+    {
+        clusters_order[c] = c;
+    }
+
+    // Outer (facing away from center) clusters first
+    std::stable_sort(clusters_order.begin(), clusters_order.end(), [&](size_t a, size_t b) {
+        return sort_keys[a] > sort_keys[b];
+    });
+
+    size_t output_count = 0;
+
+    for(const size_t c : clusters_order)
+    {
+        const size_t begin = cluster_starts[c] * 3;
+        const size_t end   = cluster_starts[c + 1] * 3;
+
+        memcpy(destination + output_count, indices + begin, (end - begin) * sizeof(uint32_t));
+        output_count += (end - begin);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+size_t gl::optimize_vertex_fetch_remap(uint32_t* remap, const uint32_t* indices, size_t index_count,
+                                       size_t vertex_count)
+{
+    for(size_t v = 0; v < vertex_count; ++v)
+    {
+        remap[v] = UINT32_MAX;
+    }
+
+    uint32_t next_vertex = 0;
+
+    for(size_t i = 0; i < index_count; ++i)
+    {
+        uint32_t& new_index = remap[indices[i]];
+
+        if(new_index == UINT32_MAX)
+        {
+            new_index = next_vertex++;
+        }
+    }
+
+    return next_vertex;
+}
+
+void gl::remap_indices(uint32_t* destination, const uint32_t* indices, size_t index_count,
+                       const uint32_t* remap)
+{
+    for(size_t i = 0; i < index_count; ++i)
+    {
+        destination[i] = remap[indices[i]];
+    }
+}
+
+void gl::remap_vertices(void* destination, const void* vertices, size_t vertex_count,
+                        size_t vertex_size, const uint32_t* remap)
+{
+    assert((vertex_count == 0) || (destination != vertices));
+
+    unsigned char*       dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(vertices);
+
+    for(size_t v = 0; v < vertex_count; ++v)
+    {
+        if(remap[v] != UINT32_MAX)
+        {
+            memcpy(dst + remap[v] * vertex_size, src + v * vertex_size, vertex_size);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+int gl::get_optimal_index_type(size_t vertex_count)
+{
+    return can_use_16bit_indices(vertex_count) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+void gl::pack_indices_16bit(uint16_t* destination, const uint32_t* indices, size_t index_count)
+{
+    for(size_t i = 0; i < index_count; ++i)
+    {
+        assert(indices[i] <= UINT16_MAX);
+        destination[i] = static_cast<uint16_t>(indices[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+gl::MeshOptimizationReport gl::optimize_mesh(std::vector<uint32_t>& indices, std::vector<uint8_t>& vertices,
+                                             size_t vertex_size, size_t position_offset,
+                                             size_t cache_size)
+{
+    const size_t index_count  = indices.size();
+    const size_t vertex_count = vertices.size() / vertex_size;
+
+    MeshOptimizationReport report;
+    report.before = analyze_vertex_cache(indices.data(), index_count, vertex_count, cache_size);
+
+    std::vector<uint32_t> temp(index_count);
+
+    optimize_vertex_cache(temp.data(), indices.data(), index_count, vertex_count, cache_size);
+
+    optimize_overdraw(indices.data(), temp.data(), index_count,
+                      reinterpret_cast<const float*>(vertices.data() + position_offset), vertex_size,
+                      vertex_count, cache_size);
+
+    // Reuse 'temp' for remap table
+    temp.resize(vertex_count);
+    const size_t used_count = optimize_vertex_fetch_remap(temp.data(), indices.data(), index_count, vertex_count);
+
+    remap_indices(indices.data(), indices.data(), index_count, temp.data());
+
+    std::vector<uint8_t> remapped_vertices(used_count * vertex_size);
+    remap_vertices(remapped_vertices.data(), vertices.data(), vertex_count, vertex_size, temp.data());
+    vertices.swap(remapped_vertices);
+
+    report.after        = analyze_vertex_cache(indices.data(), index_count, used_count, cache_size);
+    report.vertex_count = used_count;
+    report.index_type   = get_optimal_index_type(used_count);
+
+    return report;
+}
@@ -0,0 +1,44 @@
+#include <gl_wrap/utils/std140.hpp>
+
+// -----------------------------------------------------------------------------
+// Compile-time tests (hidden here, to execute them once, not on each include)
+
+static_assert(sizeof(gl::std140::vec2) ==  8 && alignof(gl::std140::vec2) ==  8, "Test failed");
+static_assert(sizeof(gl::std140::vec4) == 16 && alignof(gl::std140::vec4) == 16, "Test failed");
+static_assert(sizeof(gl::std140::mat3) == gl::std140::traits<gl::std140::mat3>::size, "Test failed");
+static_assert(sizeof(gl::std140::mat4) == gl::std140::traits<gl::std140::mat4>::size, "Test failed");
+
+// Array elements are padded to 16 bytes stride
+static_assert(sizeof(gl::std140::array<float, 4>) == 64, "Test failed");
+static_assert(sizeof(gl::std140::array<gl::std140::vec2, 3>) == gl::std140::traits<gl::std140::array<gl::std140::vec2, 3> >::size, "Test failed");
+
+// Raw arrays of 16-bytes elements match std140 (float[N], etc - rejected)
+static_assert(gl::std140::traits<gl::std140::vec4[3]>::size == 48, "Test failed");
+static_assert(gl::std140::traits<gl::std140::mat4[2]>::size == sizeof(gl::std140::mat4[2]), "Test failed");
+
+namespace {
+
+struct TestBlock
+{
+    gl::std140::vec4            a; //   0
+    gl::std140::vec2            b; //  16
+    float                       c; //  24
+    float                       d; //  28
+    gl::std140::mat4            e; //  32
+    gl::std140::array<float, 2> f; //  96
+    gl::std140::vec3            g; // 128
+    gl::std140::vec4            h; // 144
+};
+
+GLWRAP_STD140_CHECK_FIRST(TestBlock, a);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, a, b);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, b, c);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, c, d);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, d, e);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, e, f);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, f, g);
+GLWRAP_STD140_CHECK_NEXT (TestBlock, g, h);
+
+} // namespace
+
+// -----------------------------------------------------------------------------
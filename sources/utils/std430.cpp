@@ -0,0 +1,58 @@
+#include <gl_wrap/utils/std430.hpp>
+
+// -----------------------------------------------------------------------------
+// Compile-time tests (hidden here, to execute them once, not on each include)
+
+// Unlike std140, arrays are not padded
+static_assert(sizeof(gl::std430::array<float, 4>) == 16, "Test failed");
+static_assert(sizeof(gl::std430::array<gl::std430::vec2, 3>) == 24, "Test failed");
+static_assert(gl::std430::traits<gl::std430::array<gl::std430::vec3, 2> >::size == 32, "Test failed");
+
+// Matrix columns are aligned as vecR, not padded to vec4 (as in std140)
+static_assert(sizeof(gl::std430::mat2) == 16 && alignof(gl::std430::mat2) ==  8, "Test failed");
+static_assert(sizeof(gl::std430::mat3) == 48 && alignof(gl::std430::mat3) == 16, "Test failed");
+static_assert(sizeof(gl::std430::mat4) == 64 && alignof(gl::std430::mat4) == 16, "Test failed");
+static_assert(gl::std430::traits<gl::std430::array<gl::std430::mat2, 3> >::size == 48, "Test failed");
+
+namespace {
+
+struct TestBlock
+{
+    float                       a; //  0
+    gl::std430::array<float, 3> b; //  4
+    gl::std430::vec2            c; // 16
+    gl::std430::vec4            d; // 32
+    gl::std430::uint            e; // 48
+};
+
+GLWRAP_STD430_CHECK_FIRST   (TestBlock, a);
+GLWRAP_STD430_CHECK_NEXT    (TestBlock, a, b);
+GLWRAP_STD430_CHECK_NEXT    (TestBlock, b, c);
+GLWRAP_STD430_CHECK_NEXT    (TestBlock, c, d);
+GLWRAP_STD430_CHECK_NEXT    (TestBlock, d, e);
+GLWRAP_STD430_CHECK_TRAILING(TestBlock, e, gl::std430::vec4);
+
+// Example from ShaderStorageBuffer.hpp:
+// buffer Instances { uint count; mat4 transforms[]; };
+struct alignas(16) InstancesHeader
+{
+    gl::std430::uint count;
+};
+
+GLWRAP_STD430_CHECK_FIRST   (InstancesHeader, count);
+GLWRAP_STD430_CHECK_TRAILING(InstancesHeader, count, gl::std430::mat4);
+
+// buffer B { vec2 a; mat2 b; mat2 c[]; };
+struct TestMatrices
+{
+    gl::std430::vec2 a; //  0
+    gl::std430::mat2 b; //  8
+};
+
+GLWRAP_STD430_CHECK_FIRST   (TestMatrices, a);
+GLWRAP_STD430_CHECK_NEXT    (TestMatrices, a, b);
+GLWRAP_STD430_CHECK_TRAILING(TestMatrices, b, gl::std430::mat2);
+
+} // namespace
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,316 @@
+#include <gl_wrap/utils/vertex_packing.hpp>
+
+#include <gl_wrap/gl_context.hpp>
+
+#include <cmath>   // for std::fabs(), std::nearbyint()
+#include <cstring> // for memcpy()
+
+#if !defined(GLWRAP_DISABLE_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64)
+        #define GLWRAP_SIMD_SSE2
+        #include <emmintrin.h>
+
+        #if defined(__SSE4_1__)
+            #define GLWRAP_SIMD_SSE41
+            #include <smmintrin.h>
+        #endif
+
+        #if defined(__F16C__)
+            #define GLWRAP_SIMD_F16C
+            #include <immintrin.h>
+        #endif
+    #elif defined(__aarch64__) && defined(__ARM_NEON)
+        #define GLWRAP_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+// -----------------------------------------------------------------------------
+// Scalar kernels (also used for tails of SIMD loops)
+
+/*
+    Round to nearest even, handles subnormals, infinities & NaNs.
+
+    References:
+        https://gist.github.com/rygorous/2156668 (float_to_half_fast3_rtne)
+*/
+static inline uint16_t float_to_half(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t abs_bits   = bits & 0x7FFFFFFFu;
+
+    if(abs_bits >= 0x7F800000u) // Inf or NaN
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u | ((abs_bits > 0x7F800000u) ? 0x0200u : 0u));
+    }
+
+    if(abs_bits >= 0x477FF000u) // Rounds to infinity (>= 65520)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+
+    if(abs_bits < 0x38800000u) // Half subnormal or zero
+    {
+        // Adding 0.5f aligns mantissa to half subnormal precision (2^-24),
+        // FPU performs rounding
+        float abs_value;
+        memcpy(&abs_value, &abs_bits, sizeof(abs_value));
+        abs_value += 0.5f;
+
+        memcpy(&abs_bits, &abs_value, sizeof(abs_bits));
+        return static_cast<uint16_t>(sign | (abs_bits - 0x3F000000u));
+    }
+
+    const uint32_t mantissa_odd = (abs_bits >> 13) & 1u;
+
+    abs_bits += 0xC8000FFFu;  // Exponent rebias (127 -> 15) & rounding bias
+    abs_bits += mantissa_odd; // Round to even
+
+    return static_cast<uint16_t>(sign | (abs_bits >> 13));
+}
+
+/// NaN is mapped to 0 (otherwise it passes both comparisons & its conversion
+/// to integer is undefined)
+static inline float clamp(float value, float min, float max)
+{
+    if(value != value)
+    {
+        return 0.0f;
+    }
+    return (value < min) ? min : ((value > max) ? max : value);
+}
+
+// -----------------------------------------------------------------------------
+// SIMD helpers
+
+#if defined(GLWRAP_SIMD_SSE2)
+/// NaN lanes -> 0, same as scalar clamp() (min/max would turn them to bound)
+static inline __m128 zero_nans(__m128 values)
+{
+    return _mm_and_ps(values, _mm_cmpord_ps(values, values));
+}
+#elif defined(GLWRAP_SIMD_NEON)
+/// NaN lanes -> 0, same as scalar clamp()
+static inline float32x4_t zero_nans(float32x4_t values)
+{
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(values), vceqq_f32(values, values)));
+}
+#endif
+
+static inline int16_t float_to_snorm16(float value)
+{
+    return static_cast<int16_t>(std::nearbyint(clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+static inline uint16_t float_to_unorm16(float value)
+{
+    return static_cast<uint16_t>(std::nearbyint(clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
+
+static inline uint8_t float_to_unorm8(float value)
+{
+    return static_cast<uint8_t>(std::nearbyint(clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+// -----------------------------------------------------------------------------
+
+void gl::pack_half(uint16_t* destination, const float* source, size_t count)
+{
+    size_t i = 0;
+
+#if defined(GLWRAP_SIMD_F16C)
+    for(; i + 8 <= count; i += 8)
+    {
+        const __m256 values = _mm256_loadu_ps(source + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+    }
+#elif defined(GLWRAP_SIMD_NEON)
+    for(; i + 4 <= count; i += 4)
+    {
+        const float16x4_t values = vcvt_f16_f32(vld1q_f32(source + i));
+        vst1_u16(destination + i, vreinterpret_u16_f16(values));
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        destination[i] = float_to_half(source[i]);
+    }
+}
+
+void gl::pack_snorm16(int16_t* destination, const float* source, size_t count)
+{
+    size_t i = 0;
+
+#if defined(GLWRAP_SIMD_SSE2)
+    const __m128 min   = _mm_set1_ps(-1.0f);
+    const __m128 max   = _mm_set1_ps( 1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+
+    for(; i + 8 <= count; i += 8)
+    {
+        const __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(zero_nans(_mm_loadu_ps(source + i)),     min), max), scale);
+        const __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(zero_nans(_mm_loadu_ps(source + i + 4)), min), max), scale);
+
+        // _mm_cvtps_epi32() rounds to nearest even (default MXCSR mode)
+        const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), packed);
+    }
+#elif defined(GLWRAP_SIMD_NEON)
+    for(; i + 4 <= count; i += 4)
+    {
+        float32x4_t values = zero_nans(vld1q_f32(source + i));
+        values = vmulq_n_f32(vminq_f32(vmaxq_f32(values, vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f)), 32767.0f);
+
+        vst1_s16(destination + i, vmovn_s32(vcvtnq_s32_f32(values)));
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        destination[i] = float_to_snorm16(source[i]);
+    }
+}
+
+void gl::pack_unorm16(uint16_t* destination, const float* source, size_t count)
+{
+    size_t i = 0;
+
+#if defined(GLWRAP_SIMD_SSE2)
+    const __m128 min   = _mm_setzero_ps();
+    const __m128 max   = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(65535.0f);
+
+    for(; i + 8 <= count; i += 8)
+    {
+        const __m128i a = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(zero_nans(_mm_loadu_ps(source + i)),     min), max), scale));
+        const __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(zero_nans(_mm_loadu_ps(source + i + 4)), min), max), scale));
+
+    #if defined(GLWRAP_SIMD_SSE41)
+        const __m128i packed = _mm_packus_epi32(a, b);
+    #else
+        // No unsigned saturation in SSE2: shift into signed range & back
+        const __m128i bias   = _mm_set1_epi32(32768);
+        const __m128i packed = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias)),
+                                             _mm_set1_epi16(static_cast<short>(0x8000)));
+    #endif
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), packed);
+    }
+#elif defined(GLWRAP_SIMD_NEON)
+    for(; i + 4 <= count; i += 4)
+    {
+        float32x4_t values = zero_nans(vld1q_f32(source + i));
+        values = vmulq_n_f32(vminq_f32(vmaxq_f32(values, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)), 65535.0f);
+
+        vst1_u16(destination + i, vmovn_u32(vcvtnq_u32_f32(values)));
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        destination[i] = float_to_unorm16(source[i]);
+    }
+}
+
+void gl::pack_octahedral_snorm16(int16_t* destination, const float* normals, size_t count)
+{
+    // NOTE: scalar only - branchy & 3-to-2 components shuffling, while
+    //   costs are dominated by memory traffic anyway
+    for(size_t i = 0; i < count; ++i)
+    {
+        const float* n = normals + i * 3;
+
+        const float length_l1 = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+        const float inv_l1    = (length_l1 > 0.0f) ? (1.0f / length_l1) : 0.0f;
+
+        float x = n[0] * inv_l1;
+        float y = n[1] * inv_l1;
+
+        if(n[2] < 0.0f)
+        {
+            const float folded_x = (1.0f - std::fabs(y)) * ((x >= 0.0f) ? 1.0f : -1.0f);
+            const float folded_y = (1.0f - std::fabs(x)) * ((y >= 0.0f) ? 1.0f : -1.0f);
+
+            x = folded_x;
+            y = folded_y;
+        }
+
+        destination[i * 2 + 0] = float_to_snorm16(x);
+        destination[i * 2 + 1] = float_to_snorm16(y);
+    }
+}
+
+void gl::pack_colors_rgba8(uint32_t* destination, const gl::ColorRGBA* colors, size_t count)
+{
+    static_assert(sizeof(gl::ColorRGBA) == sizeof(float) * 4, "gl::ColorRGBA must be tightly packed");
+
+    const float* source = reinterpret_cast<const float*>(colors);
+
+    size_t i = 0;
+
+#if defined(GLWRAP_SIMD_SSE2)
+    const __m128 min   = _mm_setzero_ps();
+    const __m128 max   = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128i c[4];
+        for(int k = 0; k < 4; ++k)
+        {
+            const __m128 values = zero_nans(_mm_loadu_ps(source + (i + k) * 4));
+            c[k] = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(values, min), max), scale));
+        }
+
+        // Values are in [0, 255], so signed saturation of 1st step is no-op
+        const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(c[0], c[1]), _mm_packs_epi32(c[2], c[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), packed);
+    }
+#elif defined(GLWRAP_SIMD_NEON)
+    for(; i + 2 <= count; i += 2)
+    {
+        float32x4_t a = zero_nans(vld1q_f32(source + i * 4));
+        float32x4_t b = zero_nans(vld1q_f32(source + i * 4 + 4));
+
+        a = vmulq_n_f32(vminq_f32(vmaxq_f32(a, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)), 255.0f);
+        b = vmulq_n_f32(vminq_f32(vmaxq_f32(b, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)), 255.0f);
+
+        const uint16x8_t halfs = vcombine_u16(vmovn_u32(vcvtnq_u32_f32(a)), vmovn_u32(vcvtnq_u32_f32(b)));
+        vst1_u8(reinterpret_cast<uint8_t*>(destination + i), vmovn_u16(halfs));
+    }
+#endif
+
+    for(; i < count; ++i)
+    {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(destination + i);
+
+        for(int k = 0; k < 4; ++k)
+        {
+            bytes[k] = float_to_unorm8(source[i * 4 + k]);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+gl::VertexAttributeFormat gl::get_packed_attribute_format(gl::PackedFormat format, int components)
+{
+    switch (format) {
+#if defined(GL_HALF_FLOAT)
+    case PackedFormat::Half:         return { components, GL_HALF_FLOAT,      false };
+#elif defined(GL_HALF_FLOAT_OES)
+    case PackedFormat::Half:         return { components, GL_HALF_FLOAT_OES,  false };
+#endif
+    case PackedFormat::Snorm16:      return { components, GL_SHORT,           true  };
+    case PackedFormat::Unorm16:      return { components, GL_UNSIGNED_SHORT,  true  };
+    case PackedFormat::Octahedral16: return { 2,          GL_SHORT,           true  };
+    case PackedFormat::RGBA8:        return { 4,          GL_UNSIGNED_BYTE,   true  };
+    default:
+        break;
+    }
+
+    return { components, GL_FLOAT, false };
+}